@@ -1,6 +1,6 @@
 // G8RTOS.h
 // Date Created: 2023-07-26
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // RTOS module for uP 2023
 
 #ifndef G8RTOS_H_
@@ -8,8 +8,16 @@
 
 #include "G8RTOS_Scheduler.h"
 #include "G8RTOS_Semaphores.h"
+#include "G8RTOS_Mutex.h"
+#include "G8RTOS_EventGroup.h"
+#include "G8RTOS_Notify.h"
+#include "G8RTOS_Timer.h"
+#include "G8RTOS_Deferred.h"
 #include "G8RTOS_Structures.h"
 #include "G8RTOS_CriticalSection.h"
 #include "G8RTOS_IPC.h"
+#include "G8RTOS_Mailbox.h"
+#include "G8RTOS_MemPool.h"
+#include "G8RTOS_Trace.h"
 
 #endif /* G8RTOS_H_ */
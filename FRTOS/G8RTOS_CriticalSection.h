@@ -1,7 +1,7 @@
 // G8RTOS_CriticalSection.h
 // Date Created: 2023-07-26
-// Date Updated: 2024-04-08
-// Critical section function prototypes. To be defined using assembly.
+// Date Updated: 2026-10-16
+// Critical section and exclusive access function prototypes. To be defined using assembly.
 
 #ifndef G8RTOS_CRITICALSECTION_H_
 #define G8RTOS_CRITICALSECTION_H_
@@ -9,6 +9,7 @@
 /************************************Includes***************************************/
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "G8RTOS_Structures.h"
 
@@ -34,6 +35,10 @@ uint32_t IBit_State;
 
 extern int32_t StartCriticalSection();
 extern void EndCriticalSection(int32_t IBit_State);
+// Lock-free with LDREX/STREX: decrement "value" if positive, increment it if not negative.
+// Return: true if "value" was changed
+extern bool AtomicTryDecrement(int32_t* value);
+extern bool AtomicTryIncrement(int32_t* value);
 
 /********************************Public Functions***********************************/
 
@@ -0,0 +1,36 @@
+// G8RTOS_Cycles.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Cycle counter used for thread statistics and trace timestamps: the DWT
+// cycle counter, unless the port's inc/hw_nvic.h provides its own.
+
+#ifndef G8RTOS_CYCLES_H_
+#define G8RTOS_CYCLES_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef CYCLE_COUNT
+#define DWT_CTRL                0xE0001000
+#define DWT_CYCCNT              0xE0001004
+#define DWT_CTRL_CYCCNTENA      0x00000001
+#define DEMCR                   0xE000EDFC
+#define DEMCR_TRCENA            0x01000000
+#define CYCLE_COUNT()           HWREG(DWT_CYCCNT)
+#define CYCLE_COUNT_INIT()      do { \
+        HWREG(DEMCR) |= DEMCR_TRCENA; \
+        HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA; \
+    } while (0)
+#endif
+
+/*************************************Defines***************************************/
+
+#endif /* G8RTOS_CYCLES_H_ */
@@ -0,0 +1,45 @@
+// G8RTOS_Deferred.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Deferred interrupt work. Define DEFERRED_WORK to 1 to start the worker
+// thread in G8RTOS_Init.
+
+#ifndef G8RTOS_DEFERRED_H_
+#define G8RTOS_DEFERRED_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Work items the queue holds, a power of two
+#ifndef DEFERRED_QUEUE_SIZE
+#define DEFERRED_QUEUE_SIZE     16
+#endif
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Work item, a function and its argument
+typedef struct deferredWork_t {
+    void (*function)(void*);
+    void* argument;
+} deferredWork_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Functions***********************************/
+
+bool G8RTOS_DeferFromISR(void (*function)(void*), void* argument);
+uint32_t G8RTOS_GetDeferredLost(void);
+
+void InitDeferredWork(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_DEFERRED_H_ */
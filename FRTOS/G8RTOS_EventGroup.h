@@ -0,0 +1,54 @@
+// G8RTOS_EventGroup.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// 32-bit event flag groups
+
+#ifndef G8RTOS_EVENTGROUP_H_
+#define G8RTOS_EVENTGROUP_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "G8RTOS_Structures.h"
+#include "G8RTOS_Scheduler.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// G8RTOS_WaitEvents options
+#define EVENT_WAIT_ANY          0x00    // Wake when any bit of the mask is set
+#define EVENT_WAIT_ALL          0x01    // Wake when every bit of the mask is set
+#define EVENT_CLEAR_ON_EXIT     0x02    // Clear the mask bits once the wait is satisfied
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Event group
+// Waiters are kept in their own wait queue, highest priority first, with the
+// mask and options they wait for in their TCB.
+typedef struct G8RTOS_EventGroup_t {
+    uint32_t flags;
+    tcb_t *waitQueue;
+} G8RTOS_EventGroup_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_InitEventGroup(G8RTOS_EventGroup_t* e);
+uint32_t G8RTOS_WaitEvents(G8RTOS_EventGroup_t* e, uint32_t mask, uint8_t options);
+sched_ErrCode_t G8RTOS_WaitEventsTimeout(G8RTOS_EventGroup_t* e, uint32_t mask, uint8_t options, uint32_t timeout, uint32_t* flags);
+uint32_t G8RTOS_SetEvents(G8RTOS_EventGroup_t* e, uint32_t bits);
+uint32_t G8RTOS_SetEventsFromISR(G8RTOS_EventGroup_t* e, uint32_t bits);
+uint32_t G8RTOS_ClearEvents(G8RTOS_EventGroup_t* e, uint32_t bits);
+uint32_t G8RTOS_GetEvents(G8RTOS_EventGroup_t* e);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_EVENTGROUP_H_ */
@@ -1,6 +1,6 @@
 // G8RTOS_IPC.h
 // Date Created: 2023-07-26
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // Interprocess communication code for G8RTOS
 
 #ifndef G8RTOS_IPC_H_
@@ -16,8 +16,13 @@
 
 /*************************************Defines***************************************/
 
+// Default buffer size of a FIFO, G8RTOS_InitFIFOBuffer sets it per FIFO
+#ifndef FIFO_SIZE
 #define FIFO_SIZE               16
+#endif
+#ifndef MAX_NUMBER_OF_FIFOS
 #define MAX_NUMBER_OF_FIFOS     5
+#endif
 
 /*************************************Defines***************************************/
 
@@ -43,8 +48,17 @@ typedef enum
 /********************************Public Functions***********************************/
 
 int32_t G8RTOS_InitFIFO(uint32_t FIFO_index);
+int32_t G8RTOS_InitFIFOBuffer(uint32_t FIFO_index, int32_t* buffer, uint32_t size);
 int32_t G8RTOS_ReadFIFO(uint32_t FIFO_index);
 int32_t G8RTOS_WriteFIFO(uint32_t FIFO_index, int32_t data);
+int32_t G8RTOS_ReadFIFOBulk(uint32_t FIFO_index, int32_t* data, uint32_t count);
+int32_t G8RTOS_WriteFIFOBulk(uint32_t FIFO_index, const int32_t* data, uint32_t count);
+int32_t G8RTOS_ReadFIFOTimeout(uint32_t FIFO_index, int32_t* data, uint32_t timeout);
+int32_t G8RTOS_WriteFIFOTimeout(uint32_t FIFO_index, int32_t data, uint32_t timeout);
+int32_t G8RTOS_ReadFIFOBulkTimeout(uint32_t FIFO_index, int32_t* data, uint32_t count, uint32_t timeout, uint32_t* transferred);
+int32_t G8RTOS_WriteFIFOBulkTimeout(uint32_t FIFO_index, const int32_t* data, uint32_t count, uint32_t timeout, uint32_t* transferred);
+int32_t G8RTOS_WriteFIFOFromISR(uint32_t FIFO_index, int32_t data);
+uint32_t G8RTOS_GetFIFOLostData(uint32_t FIFO_index);
 
 /********************************Public Functions***********************************/
 
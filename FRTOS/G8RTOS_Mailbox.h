@@ -0,0 +1,52 @@
+// G8RTOS_Mailbox.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Zero-copy mailboxes for variable-size messages
+
+#ifndef G8RTOS_MAILBOX_H_
+#define G8RTOS_MAILBOX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "./G8RTOS_Semaphores.h"
+#include "./G8RTOS_IPC.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef MAX_NUMBER_OF_MAILBOXES
+#define MAX_NUMBER_OF_MAILBOXES 4
+#endif
+// Size of the kernel region message buffers are reserved from, in words
+#ifndef MAILBOX_REGION_SIZE
+#define MAILBOX_REGION_SIZE     512
+#endif
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+int32_t G8RTOS_InitMailbox(uint32_t mailbox_index);
+void* G8RTOS_ReserveMessage(uint32_t mailbox_index, uint32_t length);
+int32_t G8RTOS_PostMessage(void* message);
+void* G8RTOS_ReceiveMessage(uint32_t mailbox_index, uint32_t* length);
+int32_t G8RTOS_ReceiveMessageTimeout(uint32_t mailbox_index, void** message, uint32_t* length, uint32_t timeout);
+void G8RTOS_ReleaseMessage(void* message);
+uint32_t G8RTOS_GetMailboxHighWater(uint32_t mailbox_index);
+uint32_t G8RTOS_GetMailboxRegionHighWater(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_MAILBOX_H_ */
@@ -0,0 +1,60 @@
+// G8RTOS_MemPool.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Fixed-block memory pools over static storage
+
+#ifndef G8RTOS_MEMPOOL_H_
+#define G8RTOS_MEMPOOL_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "./G8RTOS_Semaphores.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Block size rounded up to whole words, and never smaller than a free-list link
+#define POOL_BLOCK_WORDS(blockSize) \
+    ((((blockSize) < sizeof(void*) ? sizeof(void*) : (blockSize)) + 3) / sizeof(uint32_t))
+
+// Declares word-aligned static storage for a pool of "numBlocks" blocks
+#define G8RTOS_POOL_STORAGE(name, blockSize, numBlocks) \
+    static uint32_t name[POOL_BLOCK_WORDS(blockSize) * (numBlocks)]
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Memory pool
+// Free blocks are linked through their own first word. The "available"
+// semaphore counts them, so blocking allocations wait on it.
+typedef struct G8RTOS_MemPool_t {
+    void *freeList;
+    uint32_t blockSize;
+    uint32_t numBlocks;
+    uint32_t blocksInUse;
+    uint32_t peakInUse;
+    uint32_t failedAllocs;
+    semaphore_t available;
+} G8RTOS_MemPool_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_InitPool(G8RTOS_MemPool_t* pool, void* storage, uint32_t blockSize, uint32_t numBlocks);
+void* G8RTOS_PoolAlloc(G8RTOS_MemPool_t* pool);
+void* G8RTOS_PoolAllocBlocking(G8RTOS_MemPool_t* pool);
+int32_t G8RTOS_PoolAllocTimeout(G8RTOS_MemPool_t* pool, void** block, uint32_t timeout);
+void G8RTOS_PoolFree(G8RTOS_MemPool_t* pool, void* block);
+void G8RTOS_PoolFreeFromISR(G8RTOS_MemPool_t* pool, void* block);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_MEMPOOL_H_ */
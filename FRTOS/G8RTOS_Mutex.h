@@ -0,0 +1,51 @@
+// G8RTOS_Mutex.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Priority-inheritance mutexes
+
+#ifndef G8RTOS_MUTEX_H_
+#define G8RTOS_MUTEX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "G8RTOS_Structures.h"
+#include "G8RTOS_Scheduler.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Mutex typedef
+// The owner runs at the priority of its highest priority waiter while it holds
+// the lock, and passes that on to the owner of any mutex it is itself waiting for.
+typedef struct G8RTOS_Mutex_t {
+    tcb_t *owner;
+    uint32_t lockCount;
+    tcb_t *waitQueue;
+    struct G8RTOS_Mutex_t *nextHeld;
+} G8RTOS_Mutex_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_InitMutex(G8RTOS_Mutex_t* m);
+void G8RTOS_LockMutex(G8RTOS_Mutex_t* m);
+sched_ErrCode_t G8RTOS_LockMutexTimeout(G8RTOS_Mutex_t* m, uint32_t timeout);
+void G8RTOS_UnlockMutex(G8RTOS_Mutex_t* m);
+
+void InheritPriority(tcb_t* thread);
+void RemoveMutexWaiter(tcb_t* thread);
+void ReleaseHeldMutexes(tcb_t* thread);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_MUTEX_H_ */
@@ -0,0 +1,31 @@
+// G8RTOS_Notify.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Direct-to-thread notifications
+
+#ifndef G8RTOS_NOTIFY_H_
+#define G8RTOS_NOTIFY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "G8RTOS_Scheduler.h"
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+sched_ErrCode_t G8RTOS_NotifyGive(threadID_t threadID);
+sched_ErrCode_t G8RTOS_NotifySetBits(threadID_t threadID, uint32_t bits);
+sched_ErrCode_t G8RTOS_NotifyOverwrite(threadID_t threadID, uint32_t value);
+uint32_t G8RTOS_NotifyTake(bool clearOnExit);
+sched_ErrCode_t G8RTOS_NotifyTakeTimeout(bool clearOnExit, uint32_t timeout, uint32_t* value);
+sched_ErrCode_t G8RTOS_NotifyGiveFromISR(threadID_t threadID);
+sched_ErrCode_t G8RTOS_NotifySetBitsFromISR(threadID_t threadID, uint32_t bits);
+sched_ErrCode_t G8RTOS_NotifyOverwriteFromISR(threadID_t threadID, uint32_t value);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_NOTIFY_H_ */
@@ -1,6 +1,6 @@
 // G8RTOS_Scheduler.h
 // Date Created: 2023-07-26
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // Scheduler / initialization code for G8RTOS
 
 #ifndef G8RTOS_SCHEDULER_H_
@@ -18,14 +18,142 @@
 
 /* Status Register with the Thumb-bit Set */
 #define THUMBBIT            0x01000000
+#define EXC_RETURN_THREAD   0xFFFFFFF9 // Return to thread mode on MSP, basic frame
+#define EXC_RETURN_BASIC    0x00000010 // EXC_RETURN bit 4: clear if the frame holds FPU state
 
 #define MAX_THREADS         24 // Adjust accordingly
+#ifndef MAX_PTHREADS
 #define MAX_PTHREADS        6
-#define STACKSIZE           275 // Adjust accordingly
-#define OSINT_PRIORITY      7
+#endif
+#define STACKSIZE           275 // Default stack size in words, adjust accordingly
+#define MIN_STACKSIZE       32  // Room for the initial frame plus a little headroom
+                                // Threads that use the FPU need 42 more words per saved frame
+#ifndef STACK_ARENA_SIZE
+#define STACK_ARENA_SIZE    (MAX_THREADS * STACKSIZE) // Words shared by all thread stacks
+#endif
+#define STACK_FILL_PATTERN  0xA5A5A5A5 // Unused stack words hold this pattern
+#define HANDLE_SLOT_BITS    8 // Low bits of a thread handle that hold the TCB slot
+#define INVALID_THREAD_HANDLE 0
+#define NUM_PRIORITIES      256 // One ready list per uint8_t priority
+#define PRIORITY_GROUPS     (NUM_PRIORITIES / 32) // 32 priorities per bitmap word
+
+/* Interrupt priorities are 0 (highest) to 7, kept in the top bits of the
+ * NVIC priority byte. PendSV and SysTick run at 7. With KERNEL_BASEPRI set,
+ * kernel critical sections raise BASEPRI to OSINT_PRIORITY instead of setting
+ * PRIMASK, so interrupts above OSINT_PRIORITY are never held off by the
+ * kernel but must not call it; G8RTOS_Add_APeriodicEvent rejects them.
+ * Assemble the critical section and PendSV code with the same definitions. */
+#ifndef KERNEL_BASEPRI
+#define KERNEL_BASEPRI      0
+#endif
+#ifndef OSINT_PRIORITY
+#define OSINT_PRIORITY      1 // Highest priority of interrupts that call the kernel
+#endif
+#define HWI_PRIORITY_SHIFT  5
+#define HWI_PRIORITY_LOWEST 6 // Lowest priority of an aperiodic event
+#define KERNEL_BASEPRI_CEILING (OSINT_PRIORITY << HWI_PRIORITY_SHIFT)
+
+/* Tickless idle: the kernel adds its own idle thread, which stops the 1 ms
+ * systick and sleeps in WFI until the next wake-up or periodic deadline. */
+#ifndef TICKLESS_IDLE
+#define TICKLESS_IDLE       0
+#endif
+#define IDLE_PRIORITY       255
+#define IDLE_THREAD_ID      255
+
+/* Deferred periodic events: handlers run in a kernel thread at
+ * PERIODIC_PRIORITY instead of inside SysTick_Handler. */
+#ifndef PERIODIC_DEFERRED
+#define PERIODIC_DEFERRED   0
+#endif
+#define PERIODIC_PRIORITY   0
+#define PERIODIC_THREAD_ID  254
+
+/* Software timers: G8RTOS_Init adds a daemon thread at TIMER_DAEMON_PRIORITY
+ * that runs timer callbacks, see G8RTOS_Timer.h. */
+#ifndef SOFTWARE_TIMERS
+#define SOFTWARE_TIMERS     0
+#endif
+#ifndef TIMER_DAEMON_PRIORITY
+#define TIMER_DAEMON_PRIORITY 1
+#endif
+#ifndef TIMER_STACKSIZE
+#define TIMER_STACKSIZE     STACKSIZE
+#endif
+#define TIMER_THREAD_ID     253
+
+/* Deferred interrupt work: G8RTOS_Init adds a worker thread at
+ * DEFERRED_PRIORITY that runs work queued by G8RTOS_DeferFromISR. */
+#ifndef DEFERRED_WORK
+#define DEFERRED_WORK       0
+#endif
+#ifndef DEFERRED_PRIORITY
+#define DEFERRED_PRIORITY   1
+#endif
+#ifndef DEFERRED_STACKSIZE
+#define DEFERRED_STACKSIZE  STACKSIZE
+#endif
+#define DEFERRED_THREAD_ID  252
+
+/* Real-time threads run periodic jobs under RT_POLICY: RT_POLICY_RM gives
+ * each a fixed priority from RT_PRIORITY_BASE up, shorter deadlines first
+ * (rate-monotonic when deadlines equal periods); RT_POLICY_EDF runs them all
+ * at RT_PRIORITY_BASE, earliest absolute deadline first. Other threads
+ * should not use the priorities they take. */
+#define RT_POLICY_RM        0
+#define RT_POLICY_EDF       1
+#ifndef RT_POLICY
+#define RT_POLICY           RT_POLICY_RM
+#endif
+#ifndef MAX_RT_THREADS
+#define MAX_RT_THREADS      8
+#endif
+#ifndef RT_PRIORITY_BASE
+#define RT_PRIORITY_BASE    2
+#endif
+
+/* Ticks a thread runs before the next ready thread of the same priority
+ * gets a turn; G8RTOS_SetTimeSlice changes it per thread. */
+#ifndef TIME_SLICE
+#define TIME_SLICE          1
+#endif
+
+/* CPU load is measured over windows of this many ticks. Time spent in
+ * threads at IDLE_PRIORITY counts as idle. */
+#ifndef LOAD_WINDOW_TICKS
+#define LOAD_WINDOW_TICKS   1000
+#endif
+#ifndef NULL
 #define NULL                0
+#endif
 #define nullptr             NULL;
 
+/* Declares an 8-byte aligned stack of "words" words for a static thread. */
+#define G8RTOS_STACK(name, words) static uint64_t name[((words) + 1) / 2]
+
+/* Initializer for a G8RTOS_StaticThread_t entry whose stack was declared
+ * with G8RTOS_STACK, so the stack size is fixed at compile time. */
+#define G8RTOS_STATIC_THREAD(function, priority, name, threadID, stack) \
+    { (function), (priority), (name), (threadID), (uint32_t*)(stack), sizeof(stack) / sizeof(uint32_t) }
+
+/* Count leading zeros, compiles to a single CLZ instruction on the M4. */
+#if defined(__TI_ARM__)
+#define CLZ(x)              _norm(x)
+#else
+#define CLZ(x)              __builtin_clz(x)
+#endif
+
+/* Makes sure the PendSV just pended is taken before the next instruction,
+ * so a thread that blocked itself does not run on and read its wait result
+ * before it has switched out. The host port switches inside the write. */
+#if defined(__TI_ARM__)
+#define SWITCH_BARRIER()    do { __asm(" dsb"); __asm(" isb"); } while (0)
+#elif defined(__arm__)
+#define SWITCH_BARRIER()    __asm volatile ("dsb\n\tisb" ::: "memory")
+#else
+#define SWITCH_BARRIER()    __asm volatile ("" ::: "memory")
+#endif
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
@@ -40,17 +168,53 @@ typedef enum
     THREAD_DOES_NOT_EXIST = -4,
     CANNOT_KILL_LAST_THREAD = -5,
     IRQn_INVALID = -6,
-    HWI_PRIORITY_INVALID = -7
+    HWI_PRIORITY_INVALID = -7,
+    STACK_ARENA_FULL = -8,
+    THREAD_ID_IN_USE = -9,
+    ADMISSION_REJECTED = -10,
+    WAIT_TIMEOUT = -11,
+    STACK_TOO_SMALL = -12,
+    INVALID_PERIOD = -13
 } sched_ErrCode_t;
 
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+// Thread declared at compile time, see G8RTOS_AddStaticThreads
+typedef struct G8RTOS_StaticThread_t {
+    void (*function)(void);
+    uint8_t priority;
+    char* name;
+    uint8_t threadID;
+    uint32_t* stack;                // Owned by the caller, at least MIN_STACKSIZE words
+    uint32_t stackSize;             // Words, even
+} G8RTOS_StaticThread_t;
+
+// Snapshot of a thread's run-time statistics
+typedef struct G8RTOS_ThreadStats_t {
+    threadID_t threadID;
+    char threadName[MAX_NAME_LENGTH];
+    uint8_t priority;
+    uint64_t runCycles;             // Cycles spent running, see G8RTOS_Cycles.h
+    uint32_t switches;              // Times switched in
+    uint32_t preemptions;           // Times switched out while still ready
+} G8RTOS_ThreadStats_t;
+
+// Snapshot of a real-time thread's job statistics
+typedef struct G8RTOS_RealTimeStats_t {
+    uint32_t jobs;                  // Jobs completed
+    uint32_t deadlineMisses;        // Jobs completed at or after their deadline
+    uint32_t budgetOverruns;        // Jobs that ran longer than their budget
+    uint32_t worstResponse;         // Longest release to completion time, in ticks
+} G8RTOS_RealTimeStats_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /********************************Public Variables***********************************/
 
 extern tcb_t* CurrentlyRunningThread;
+extern uint32_t SystemTime;
 
 /********************************Public Variables***********************************/
 
@@ -66,17 +230,40 @@ int32_t G8RTOS_Launch(void);
 void G8RTOS_Scheduler(void);
 
 void SetInitialStack(unsigned int index);
-sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, char *name, uint8_t threadID);
+void AddToReadyList(tcb_t* thread);
+void RemoveFromReadyList(tcb_t* thread);
+void AddToWaitQueue(tcb_t** queue, tcb_t* thread);
+void RemoveFromWaitQueue(tcb_t* thread);
+void SetThreadPriority(tcb_t* thread, uint8_t priority);
+tcb_t* ThreadOfID(threadID_t threadID);
+tcb_t* ThreadOfHandle(threadHandle_t handle);
+bool InHandlerMode(void);
+void RequestSwitchFromISR(void);
+void StartTimeout(tcb_t* thread, uint32_t ticks);
+sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, char *name, uint8_t threadID, uint32_t stackSize);
+sched_ErrCode_t G8RTOS_AddThreadHandle(void (*threadToAdd)(void), uint8_t priority, char *name, uint8_t threadID, uint32_t stackSize, threadHandle_t* handle);
+sched_ErrCode_t G8RTOS_AddStaticThreads(const G8RTOS_StaticThread_t* threads, uint32_t count);
+sched_ErrCode_t G8RTOS_AddRealTimeThread(void (*threadToAdd)(void), char *name, uint8_t threadID, uint32_t stackSize, uint32_t period, uint32_t budget, uint32_t deadline);
+void G8RTOS_WaitNextPeriod(void);
 sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t priority, int32_t IRQn);
 sched_ErrCode_t G8RTOS_Add_PeriodicEvent(void (*PthreadToAdd)(void), uint32_t period, uint32_t execution);
+sched_ErrCode_t G8RTOS_Remove_PeriodicEvent(void (*PthreadToRemove)(void));
 sched_ErrCode_t G8RTOS_KillThread(threadID_t threadID);
+sched_ErrCode_t G8RTOS_KillThreadHandle(threadHandle_t handle);
 sched_ErrCode_t G8RTOS_KillSelf(void);
+sched_ErrCode_t G8RTOS_SetTimeSlice(threadID_t threadID, uint16_t ticks);
+void G8RTOS_ExitISR(void);
 
 void sleep(uint32_t durationMS);
 
 threadID_t G8RTOS_GetThreadID(void);
+threadHandle_t G8RTOS_GetThreadHandle(threadID_t threadID);
 uint32_t G8RTOS_GetNumberOfThreads(void);
 uint32_t G8RTOS_GetSysTime(void);
+int32_t G8RTOS_GetStackHighWater(threadID_t threadID);
+sched_ErrCode_t G8RTOS_GetThreadStats(uint32_t index, G8RTOS_ThreadStats_t* stats);
+uint32_t G8RTOS_GetCPULoad(void);
+sched_ErrCode_t G8RTOS_GetRealTimeStats(threadID_t threadID, G8RTOS_RealTimeStats_t* stats);
 
 /********************************Public Functions***********************************/
 
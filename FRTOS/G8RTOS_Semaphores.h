@@ -1,6 +1,6 @@
 // G8RTOS_Semaphore.h
 // Date Created: 2023-07-26
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // Semaphores
 
 #ifndef G8RTOS_SEMAPHORES_H_
@@ -8,22 +8,34 @@
 
 /************************************Includes***************************************/
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
+#ifndef NULL
 #define NULL 0
+#endif
+
+// Timeouts of the timed waits, in systicks. A timeout of 0 only polls.
+#define WAIT_FOREVER 0xFFFFFFFF
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
 
-// Semaphore typedef
-typedef int32_t semaphore_t;
-
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+// Semaphore typedef
+// A negative count is the number of threads in the wait queue, which is
+// ordered highest priority first and FIFO within a priority.
+typedef struct semaphore_t {
+    int32_t count;
+    struct tcb_t *waitQueue;
+} semaphore_t;
+
 /****************************Data Structure Definitions*****************************/
 
 
@@ -31,7 +43,10 @@ typedef int32_t semaphore_t;
 
 void G8RTOS_InitSemaphore(semaphore_t* s, int32_t value);
 void G8RTOS_WaitSemaphore(semaphore_t* s);
+int32_t G8RTOS_WaitSemaphoreTimeout(semaphore_t* s, uint32_t timeout);
+bool G8RTOS_TryWaitSemaphore(semaphore_t* s);
 void G8RTOS_SignalSemaphore(semaphore_t* s);
+void G8RTOS_SignalSemaphoreFromISR(semaphore_t* s);
 
 /********************************Public Functions***********************************/
 
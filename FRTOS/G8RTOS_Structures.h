@@ -1,6 +1,6 @@
 // G8RTOS_Structures.h
 // Date Created: 2023-07-26
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // Thread block definitions
 
 #ifndef G8RTOS_STRUCTURES_H_
@@ -27,6 +27,10 @@
 // Thread ID
 typedef int32_t threadID_t;
 
+// Thread handle, issued by the kernel: the TCB slot in the low byte and the
+// slot's generation above it, so a handle to a killed thread goes stale
+typedef uint32_t threadHandle_t;
+
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
@@ -34,13 +38,36 @@ typedef int32_t threadID_t;
 // Thread Control Block
 typedef struct tcb_t {
     uint32_t *stackPointer;
-    struct tcb_t *nextTCB;
-    struct tcb_t *previousTCB;
+    uint32_t *stackBase;            // Lowest word of the stack, NULL once reclaimed
+    uint32_t stackSize;             // Stack size in words
+    bool staticStack;               // Stack owned by the caller, not carved from the arena
+    struct tcb_t *nextTCB;          // Free TCB list while the slot is unused
+    struct tcb_t *nextReadyTCB;     // Ready list, or sleep list while asleep
+    struct tcb_t *previousReadyTCB;
+    struct tcb_t *nextWaitTCB;      // Wait queue of a semaphore, mutex or event group
+    struct tcb_t *previousWaitTCB;
+    struct tcb_t **waitQueue;       // Head of the wait queue the thread is in
     semaphore_t *blocked;
-    uint32_t sleepCount;
+    struct G8RTOS_Mutex_t *blockedMutex;
+    struct G8RTOS_Mutex_t *heldMutexes;
+    struct rtcb_t *realTime;        // Period and deadline of a real-time thread, else NULL
+    uint32_t eventBits;             // Event group mask waited for, then the flags that woke it
+    uint8_t eventOptions;           // Event group wait options
+    uint32_t notifyValue;           // Direct-to-thread notification value
+    bool notifyWaiting;             // Blocked in G8RTOS_NotifyTake
+    bool timedOut;                  // The last timed wait ended at its timeout
+    uint32_t sleepCount;            // Ticks after the previous sleeper
     bool asleep;
-    uint8_t priority;
+    bool isReady;                   // In the ready list of its priority
+    uint8_t priority;               // Effective priority, raised by inheritance
+    uint8_t basePriority;
+    uint16_t timeSlice;             // Ticks before yielding to an equal priority thread, 0 for none
+    uint16_t sliceRemaining;
     bool isAlive;
+    uint16_t generation;            // Times the slot has been used, never 0 once used
+    uint64_t runCycles;             // Cycles spent running
+    uint32_t switchCount;           // Times switched in
+    uint32_t preemptCount;          // Times switched out while still ready
     char threadName[MAX_NAME_LENGTH];
     threadID_t ThreadID;
 } tcb_t;
@@ -48,13 +75,32 @@ typedef struct tcb_t {
 // Periodic Thread Control Block
 typedef struct ptcb_t {
     void (*handler)(void);
-    struct ptcb_t *previousPTCB;
+    struct ptcb_t *previousPTCB;    // Release queue, sorted by next release
     struct ptcb_t *nextPTCB;
+    struct ptcb_t *nextDuePTCB;     // Released, waiting for the periodic thread
     uint32_t period;
-    uint32_t executeTime;
-    uint32_t currentTime;
+    uint32_t executeTime;           // Phase offset of the first release
+    uint32_t releaseCount;          // Ticks after the previous event's release
+    bool isActive;
+    bool isDue;
 } ptcb_t;
 
+// Real-time Thread Control Block
+typedef struct rtcb_t {
+    struct tcb_t *thread;
+    uint32_t period;                // Ticks between releases
+    uint32_t budget;                // Worst-case execution time in ticks
+    uint32_t deadline;              // Ticks from release, at most the period
+    uint32_t release;               // SystemTime of the current job's release
+    uint32_t absoluteDeadline;      // SystemTime the current job is due by
+    uint64_t jobStart;              // The thread's run cycles when the current job started
+    uint32_t jobs;                  // Jobs completed
+    uint32_t deadlineMisses;        // Jobs completed at or after their deadline
+    uint32_t budgetOverruns;        // Jobs that ran longer than their budget
+    uint32_t worstResponse;         // Longest release to completion time, in ticks
+    bool isActive;
+} rtcb_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /********************************Public Variables***********************************/
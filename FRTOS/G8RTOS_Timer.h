@@ -0,0 +1,60 @@
+// G8RTOS_Timer.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Software timers, run by a kernel daemon thread. Define SOFTWARE_TIMERS to 1
+// to start the daemon in G8RTOS_Init.
+
+#ifndef G8RTOS_TIMER_H_
+#define G8RTOS_TIMER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Software timer
+// Running timers are kept in a delta list sorted by expiry, so the systick
+// only counts down the first one. Expired timers wait in a due list for the
+// timer daemon, which runs their callbacks and re-arms auto-reload timers.
+// Timers started from ISRs wait in a pending list for the daemon to insert
+// them, so interrupt handlers never walk the delta list.
+typedef struct G8RTOS_Timer_t {
+    void (*callback)(struct G8RTOS_Timer_t *timer);
+    void *context;                  // For the callback's use
+    uint32_t period;                // Ticks
+    uint32_t expiry;                // SystemTime of the next expiry
+    uint32_t delta;                 // Ticks after the previous timer in the list
+    struct G8RTOS_Timer_t *nextTimer;       // In the timer list or the pending list
+    struct G8RTOS_Timer_t *previousTimer;
+    struct G8RTOS_Timer_t *nextDueTimer;
+    struct G8RTOS_Timer_t *previousDueTimer;
+    bool autoReload;
+    bool isRunning;                 // In the timer list
+    bool isPending;                 // In the pending list
+    bool isDue;                     // In the due list
+} G8RTOS_Timer_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_InitTimer(G8RTOS_Timer_t* timer, void (*callback)(G8RTOS_Timer_t*), uint32_t period, bool autoReload, void* context);
+void G8RTOS_StartTimer(G8RTOS_Timer_t* timer);
+void G8RTOS_StartTimerFromISR(G8RTOS_Timer_t* timer);
+void G8RTOS_StopTimer(G8RTOS_Timer_t* timer);
+void G8RTOS_ResetTimer(G8RTOS_Timer_t* timer);
+void G8RTOS_ResetTimerFromISR(G8RTOS_Timer_t* timer);
+bool G8RTOS_TimerIsActive(G8RTOS_Timer_t* timer);
+
+void InitTimerService(void);
+void TimerTick(void);
+uint32_t NextTimerExpiry(void);
+void StepTimers(uint32_t ticks);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_TIMER_H_ */
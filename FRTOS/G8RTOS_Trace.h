@@ -0,0 +1,97 @@
+// G8RTOS_Trace.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Binary kernel event trace. Define G8RTOS_TRACE to 1 to record scheduler,
+// semaphore, FIFO, sleep, periodic and interrupt events into a ring buffer.
+// Dump G8RTOS_TraceBuffer from the debugger and decode it on the host with
+// g8rtos_trace_decode, which writes Chrome trace JSON.
+
+#ifndef G8RTOS_TRACE_H_
+#define G8RTOS_TRACE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef G8RTOS_TRACE
+#define G8RTOS_TRACE            0
+#endif
+
+// Number of records kept, a power of two
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE       256
+#endif
+
+#define TRACE_MAGIC             0x52543847  // "G8TR"
+
+#if G8RTOS_TRACE
+#define TRACE(event, arg)       G8RTOS_TraceRecord((event), (uint16_t)(arg))
+#else
+#define TRACE(event, arg)       do { } while (0)
+#endif
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Trace events. The record's thread is the thread running when it was made.
+typedef enum trace_Event_t {
+    TRACE_SWITCH = 1,               // arg: thread switched in, the record's thread is switched out
+    TRACE_SEMAPHORE_BLOCK = 2,      // arg: semaphore address / 4
+    TRACE_SEMAPHORE_UNBLOCK = 3,    // arg: thread made ready
+    TRACE_FIFO_READ = 4,            // arg: FIFO index
+    TRACE_FIFO_WRITE = 5,           // arg: FIFO index
+    TRACE_FIFO_LOST = 6,            // arg: FIFO index
+    TRACE_SLEEP = 7,                // arg: duration in ms, saturated
+    TRACE_WAKE = 8,                 // arg: thread woken
+    TRACE_PERIODIC_RELEASE = 9,     // arg: periodic event index
+    TRACE_ISR_ENTER = 10,           // arg: vector number
+    TRACE_ISR_EXIT = 11,            // arg: vector number
+} trace_Event_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Trace record, 8 bytes
+typedef struct traceRecord_t {
+    uint32_t timestamp;             // Cycles
+    uint8_t event;                  // trace_Event_t
+    uint8_t thread;                 // Thread ID, 0xFF before the first thread
+    uint16_t arg;
+} traceRecord_t;
+
+// Trace buffer. "head" counts every record made; the newest is at
+// (head - 1) % TRACE_BUFFER_SIZE. The layout is what the decoder reads.
+typedef struct G8RTOS_Trace_t {
+    uint32_t magic;
+    uint32_t clockHz;
+    uint32_t size;
+    uint32_t head;
+    uint32_t enabled;
+    traceRecord_t records[TRACE_BUFFER_SIZE];
+} G8RTOS_Trace_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Variables***********************************/
+
+extern G8RTOS_Trace_t G8RTOS_TraceBuffer;
+
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_TraceInit(void);
+void G8RTOS_TraceRecord(uint8_t event, uint16_t arg);
+void G8RTOS_TraceStart(void);
+void G8RTOS_TraceStop(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_TRACE_H_ */
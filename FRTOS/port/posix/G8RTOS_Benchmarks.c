@@ -0,0 +1,315 @@
+// G8RTOS_Benchmarks.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Scheduler, semaphore, notification and FIFO throughput benchmarks for the POSIX host port,
+// and worst-case priority inversion with and without priority inheritance.
+// Times are host wall-clock times: compare them between builds on the same
+// machine, not with the target.
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "G8RTOS.h"
+#include "G8RTOS_Port.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define BENCH_PRIORITY          0
+#define WORKER_PRIORITY         10
+#define SCHEDULER_CALLS         1000000
+#define SEMAPHORE_PAIRS         1000000
+#define PING_PONG_ROUNDS        200000
+#define FIFO_WORDS              1000000
+#define FIFO_CHUNK              8
+#define FIFO_INDEX              0
+#define WORKER_1_ID             1
+#define WORKER_2_ID             2
+#define WORKER_3_ID             3
+// Priority inversion: the low thread holds the lock for INVERSION_HOLD_TICKS
+// while the medium thread spins for INVERSION_SPIN_TICKS
+#define INVERSION_TRIALS        20
+#define INVERSION_HOLD_TICKS    3
+#define INVERSION_SPIN_TICKS    20
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+static semaphore_t Done;
+static semaphore_t Ping;
+static semaphore_t Pong;
+static volatile uint32_t FIFOSum;
+
+// Lock the inversion threads share: a mutex, or a binary semaphore when
+// UseInheritance is false
+static G8RTOS_Mutex_t InversionMutex;
+static semaphore_t InversionSemaphore;
+static bool UseInheritance;
+static uint64_t WorstBlockingNs;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// Report
+// Prints one benchmark result.
+// Param char* "name": benchmark name
+// Param uint64_t "ns": elapsed host time
+// Param uint32_t "operations": number of operations timed
+// Return: void
+static void Report(char* name, uint64_t ns, uint32_t operations) {
+    printf("%-36s %10u ops %10.1f ns/op %12.0f ops/s\n", name, operations,
+           (double)ns / operations, operations * 1e9 / (double)ns);
+    return;
+}
+
+static void Spinner(void) {
+    while (1);
+}
+
+static void PingThread(void) {
+    for (uint32_t i = 0; i < PING_PONG_ROUNDS; i++) {
+        G8RTOS_SignalSemaphore(&Ping);
+        G8RTOS_WaitSemaphore(&Pong);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void PongThread(void) {
+    for (uint32_t i = 0; i < PING_PONG_ROUNDS; i++) {
+        G8RTOS_WaitSemaphore(&Ping);
+        G8RTOS_SignalSemaphore(&Pong);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Same round trip as PingThread/PongThread with thread notifications
+static void NotifyPingThread(void) {
+    for (uint32_t i = 0; i < PING_PONG_ROUNDS; i++) {
+        G8RTOS_NotifyGive(WORKER_2_ID);
+        G8RTOS_NotifyTake(false);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void NotifyPongThread(void) {
+    for (uint32_t i = 0; i < PING_PONG_ROUNDS; i++) {
+        G8RTOS_NotifyTake(false);
+        G8RTOS_NotifyGive(WORKER_1_ID);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void FIFOProducer(void) {
+    for (int32_t i = 0; i < FIFO_WORDS; i++) G8RTOS_WriteFIFO(FIFO_INDEX, i);
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void FIFOConsumer(void) {
+    uint32_t sum = 0;
+    for (int32_t i = 0; i < FIFO_WORDS; i++) sum += G8RTOS_ReadFIFO(FIFO_INDEX);
+    FIFOSum = sum;
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void FIFOBulkProducer(void) {
+    int32_t chunk[FIFO_CHUNK];
+    for (int32_t i = 0; i < FIFO_WORDS; i += FIFO_CHUNK) {
+        for (int32_t j = 0; j < FIFO_CHUNK; j++) chunk[j] = i + j;
+        G8RTOS_WriteFIFOBulk(FIFO_INDEX, chunk, FIFO_CHUNK);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void FIFOBulkConsumer(void) {
+    int32_t chunk[FIFO_CHUNK];
+    uint32_t sum = 0;
+    for (int32_t i = 0; i < FIFO_WORDS; i += FIFO_CHUNK) {
+        G8RTOS_ReadFIFOBulk(FIFO_INDEX, chunk, FIFO_CHUNK);
+        for (int32_t j = 0; j < FIFO_CHUNK; j++) sum += chunk[j];
+    }
+    FIFOSum = sum;
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void AcquireInversionLock(void) {
+    if (UseInheritance) G8RTOS_LockMutex(&InversionMutex);
+    else G8RTOS_WaitSemaphore(&InversionSemaphore);
+}
+
+static void ReleaseInversionLock(void) {
+    if (UseInheritance) G8RTOS_UnlockMutex(&InversionMutex);
+    else G8RTOS_SignalSemaphore(&InversionSemaphore);
+}
+
+// SpinTicks
+// Busy-waits for "ticks" systicks without blocking.
+// Return: void
+static void SpinTicks(uint32_t ticks) {
+    uint32_t start = G8RTOS_GetSysTime();
+    while (G8RTOS_GetSysTime() - start < ticks);
+}
+
+// Takes the lock first and holds it across the other two waking up
+static void InversionLow(void) {
+    AcquireInversionLock();
+    SpinTicks(INVERSION_HOLD_TICKS);
+    ReleaseInversionLock();
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Wakes while the low thread holds the lock and preempts it unless it inherited
+static void InversionMedium(void) {
+    sleep(2);
+    SpinTicks(INVERSION_SPIN_TICKS);
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Blocks on the lock, timing how long it waits
+static void InversionHigh(void) {
+    sleep(1);
+    uint64_t start = HostPort_GetTimeNs();
+    AcquireInversionLock();
+    uint64_t ns = HostPort_GetTimeNs() - start;
+    ReleaseInversionLock();
+    if (ns > WorstBlockingNs) WorstBlockingNs = ns;
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// BenchInversion
+// Measures the worst time a high priority thread waits for a lock held by a
+// low priority thread while a medium priority thread is busy.
+// Param bool "inheritance": lock with a mutex rather than a binary semaphore
+// Return: void
+static void BenchInversion(bool inheritance) {
+    UseInheritance = inheritance;
+    WorstBlockingNs = 0;
+    for (uint32_t i = 0; i < INVERSION_TRIALS; i++) {
+        G8RTOS_AddThread(InversionHigh, WORKER_PRIORITY, "high", WORKER_1_ID, STACKSIZE);
+        G8RTOS_AddThread(InversionMedium, WORKER_PRIORITY + 1, "medium", WORKER_2_ID, STACKSIZE);
+        G8RTOS_AddThread(InversionLow, WORKER_PRIORITY + 2, "low", WORKER_3_ID, STACKSIZE);
+        for (uint32_t j = 0; j < 3; j++) G8RTOS_WaitSemaphore(&Done);
+        G8RTOS_KillThread(WORKER_1_ID);
+        G8RTOS_KillThread(WORKER_2_ID);
+        G8RTOS_KillThread(WORKER_3_ID);
+    }
+    printf("%-36s %10u runs %10.1f us worst blocking\n",
+           inheritance ? "priority inversion, mutex" : "priority inversion, semaphore",
+           INVERSION_TRIALS, WorstBlockingNs / 1e3);
+    return;
+}
+
+// BenchScheduler
+// Times G8RTOS_Scheduler with "threads" extra ready threads spread over as
+// many priorities below the benchmark thread.
+// Param uint32_t "threads": number of extra ready threads
+// Return: void
+static void BenchScheduler(uint32_t threads) {
+    char name[48];
+    for (uint32_t i = 0; i < threads; i++) {
+        G8RTOS_AddThread(Spinner, WORKER_PRIORITY + i, "spinner", i + 1, MIN_STACKSIZE);
+    }
+    int32_t IBit_State = StartCriticalSection();
+    tcb_t* self = CurrentlyRunningThread;
+    uint64_t start = HostPort_GetTimeNs();
+    for (uint32_t i = 0; i < SCHEDULER_CALLS; i++) G8RTOS_Scheduler();
+    uint64_t ns = HostPort_GetTimeNs() - start;
+    CurrentlyRunningThread = self;
+    EndCriticalSection(IBit_State);
+    for (uint32_t i = 0; i < threads; i++) G8RTOS_KillThread(i + 1);
+    snprintf(name, sizeof(name), "scheduler, %u other threads", threads);
+    Report(name, ns, SCHEDULER_CALLS);
+    return;
+}
+
+// RunPair
+// Runs two worker threads to completion and returns the time they took.
+// Return: uint64_t, elapsed host time in ns
+static uint64_t RunPair(void (*first)(void), void (*second)(void)) {
+    uint64_t start = HostPort_GetTimeNs();
+    G8RTOS_AddThread(first, WORKER_PRIORITY, "worker 1", WORKER_1_ID, STACKSIZE);
+    G8RTOS_AddThread(second, WORKER_PRIORITY, "worker 2", WORKER_2_ID, STACKSIZE);
+    G8RTOS_WaitSemaphore(&Done);
+    G8RTOS_WaitSemaphore(&Done);
+    uint64_t ns = HostPort_GetTimeNs() - start;
+    // A worker preempted between signalling Done and killing itself still
+    // holds its ID, so finish it off before the IDs are reused.
+    G8RTOS_KillThread(WORKER_1_ID);
+    G8RTOS_KillThread(WORKER_2_ID);
+    return ns;
+}
+
+static void BenchThread(void) {
+    uint64_t start, ns;
+    uint32_t switches;
+
+    BenchScheduler(0);
+    BenchScheduler(4);
+    BenchScheduler(16);
+
+    start = HostPort_GetTimeNs();
+    for (uint32_t i = 0; i < SEMAPHORE_PAIRS; i++) {
+        G8RTOS_SignalSemaphore(&Ping);
+        G8RTOS_WaitSemaphore(&Ping);
+    }
+    Report("semaphore signal + wait, no switch", HostPort_GetTimeNs() - start, SEMAPHORE_PAIRS);
+
+    start = HostPort_GetTimeNs();
+    for (uint32_t i = 0; i < SEMAPHORE_PAIRS; i++) {
+        G8RTOS_WriteFIFO(FIFO_INDEX, i);
+        FIFOSum += G8RTOS_ReadFIFO(FIFO_INDEX);
+    }
+    Report("FIFO write + read, no switch", HostPort_GetTimeNs() - start, SEMAPHORE_PAIRS);
+
+    switches = HostPort_ContextSwitches;
+    ns = RunPair(PingThread, PongThread);
+    Report("semaphore ping-pong round", ns, PING_PONG_ROUNDS);
+    Report("context switch", ns, HostPort_ContextSwitches - switches);
+
+    ns = RunPair(NotifyPingThread, NotifyPongThread);
+    Report("notification ping-pong round", ns, PING_PONG_ROUNDS);
+
+    ns = RunPair(FIFOProducer, FIFOConsumer);
+    Report("FIFO word, blocking", ns, FIFO_WORDS);
+    if (FIFOSum != (uint32_t)((uint64_t)FIFO_WORDS * (FIFO_WORDS - 1) / 2)) printf("FIFO checksum mismatch\n");
+
+    ns = RunPair(FIFOBulkProducer, FIFOBulkConsumer);
+    Report("FIFO word, bulk", ns, FIFO_WORDS);
+    if (FIFOSum != (uint32_t)((uint64_t)FIFO_WORDS * (FIFO_WORDS - 1) / 2)) printf("FIFO checksum mismatch\n");
+
+    BenchInversion(false);
+    BenchInversion(true);
+
+    fflush(stdout);
+    exit(0);
+}
+
+/*******************************Private Functions***********************************/
+
+int main(void) {
+    G8RTOS_Init();
+    G8RTOS_InitSemaphore(&Done, 0);
+    G8RTOS_InitSemaphore(&Ping, 0);
+    G8RTOS_InitSemaphore(&Pong, 0);
+    G8RTOS_InitFIFO(FIFO_INDEX);
+    G8RTOS_InitMutex(&InversionMutex);
+    G8RTOS_InitSemaphore(&InversionSemaphore, 1);
+    G8RTOS_AddThread(BenchThread, BENCH_PRIORITY, "benchmarks", 0, STACKSIZE);
+    G8RTOS_Launch();
+    return 1;
+}
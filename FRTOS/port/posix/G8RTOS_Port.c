@@ -0,0 +1,455 @@
+// G8RTOS_Port.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// POSIX host port. Stands in for the assembly in G8RTOS_SchedulerASM.s and
+// G8RTOS_CriticalSectionASM.s and for the parts of driverlib the kernel uses.
+
+// Not _GNU_SOURCE: it declares POSIX sleep(), which clashes with the kernel's.
+#define _XOPEN_SOURCE 700
+
+#include "G8RTOS_Port.h"
+
+/************************************Includes***************************************/
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "G8RTOS_Scheduler.h"
+#include "G8RTOS_CriticalSection.h"
+
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/systick.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/fpu.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Register value SetInitialStack leaves in R4 of a new thread
+#define INITIAL_R4          0x04040404
+// Word offsets of the saved R4 and PC from the initial stack pointer
+#define INITIAL_R4_OFFSET   1
+#define INITIAL_PC_OFFSET   16
+
+/*************************************Defines***************************************/
+
+/********************************Public Variables***********************************/
+
+volatile uint32_t HostPort_NVIC_INT_CTRL;
+volatile uint32_t HostPort_NVIC_VTABLE;
+volatile uint32_t HostPort_NVIC_ST_CTRL;
+volatile uint32_t HostPort_NVIC_ST_CURRENT;
+
+volatile uint32_t HostPort_ContextSwitches;
+
+/********************************Public Variables***********************************/
+
+/********************************Private Variables**********************************/
+
+// Host context of each thread control block, indexed by TCB position
+typedef struct hostThread_t {
+    tcb_t* tcb;
+    ucontext_t context;
+    void* stack;
+    void (*entry)(void);
+} hostThread_t;
+static hostThread_t HostThreads[MAX_THREADS];
+
+// Switched-out context of a thread whose TCB was reused before it left the CPU
+static ucontext_t DeadContext;
+
+// Software interrupt mask and state, only changed with SIGALRM masked or
+// from the handler itself
+static volatile sig_atomic_t InterruptsDisabled = 1;
+static volatile sig_atomic_t InInterrupt;
+static volatile sig_atomic_t PendSVPending;
+static volatile sig_atomic_t InterruptPending[NUM_INTERRUPTS];
+static volatile sig_atomic_t AnyInterruptPending;
+
+// Vector table
+static void (*Vectors[NUM_INTERRUPTS])(void);
+static bool InterruptEnabled[NUM_INTERRUPTS];
+
+// Systick model. The counter runs only while SysTickEnabled is set; the
+// timer is re-armed on the next wrap if the period changed in between.
+static timer_t SysTickTimer;
+static uint32_t SysTickPeriod = HOST_CLOCK_HZ / 1000;
+static uint32_t ArmedPeriod;
+static bool SysTickEnabled;
+static bool SysTickInterruptEnabled;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+// CyclesToTimespec
+// Param uint32_t "cycles": number of core clock cycles
+// Return: struct timespec
+static struct timespec CyclesToTimespec(uint32_t cycles) {
+    uint64_t ns = (uint64_t)cycles * 1000000000ull / HOST_CLOCK_HZ;
+    struct timespec ts = { (time_t)(ns / 1000000000ull), (long)(ns % 1000000000ull) };
+    return ts;
+}
+
+// ArmSysTick
+// Starts the systick timer counting down from "value", reloading with the
+// current period afterwards.
+// Param uint32_t "value": cycles until the first wrap
+// Return: void
+static void ArmSysTick(uint32_t value) {
+    struct itimerspec its;
+    its.it_value = CyclesToTimespec(value);
+    its.it_interval = CyclesToTimespec(SysTickPeriod);
+    ArmedPeriod = SysTickPeriod;
+    timer_settime(SysTickTimer, 0, &its, NULL);
+    return;
+}
+
+// HostThreadOf
+// TCBs live in one array, so their addresses map to distinct slots.
+// Param tcb_t* "thread": thread control block
+// Return: hostThread_t*
+static hostThread_t* HostThreadOf(tcb_t* thread) {
+    return &HostThreads[((uintptr_t)thread / sizeof(tcb_t)) % MAX_THREADS];
+}
+
+// ThreadEntry
+// First code run by every thread context.
+// Return: void
+static void ThreadEntry(void) {
+    InterruptsDisabled = 0;
+    HostThreadOf(CurrentlyRunningThread)->entry();
+    fprintf(stderr, "G8RTOS: thread %s returned\n", CurrentlyRunningThread->threadName);
+    abort();
+}
+
+// ContextOf
+// Returns the host context of a thread, creating it when the thread was
+// (re)initialized by SetInitialStack since the last switch.
+// Param tcb_t* "thread": thread control block
+// Return: ucontext_t*
+static ucontext_t* ContextOf(tcb_t* thread) {
+    hostThread_t* host = HostThreadOf(thread);
+    uint32_t* sp = thread->stackPointer;
+    if (host->tcb != thread || sp[INITIAL_R4_OFFSET] == INITIAL_R4) {
+        if (host->stack == NULL) host->stack = malloc(HOST_STACK_SIZE);
+        host->tcb = thread;
+        host->entry = (void (*)(void))(uintptr_t)sp[INITIAL_PC_OFFSET];
+        getcontext(&host->context);
+        host->context.uc_stack.ss_sp = host->stack;
+        host->context.uc_stack.ss_size = HOST_STACK_SIZE;
+        host->context.uc_link = NULL;
+        sigemptyset(&host->context.uc_sigmask);
+        makecontext(&host->context, ThreadEntry, 0);
+        sp[INITIAL_R4_OFFSET] = 0;
+    }
+    return &host->context;
+}
+
+// RunPendingInterrupts
+// Takes pending interrupts, systick first, then peripheral interrupts by IRQ
+// number, then PendSV, for as long as interrupts are enabled.
+// Return: void
+static void RunPendingInterrupts(void) {
+    while (!InterruptsDisabled && !InInterrupt && (AnyInterruptPending || PendSVPending)) {
+        if (AnyInterruptPending) {
+            AnyInterruptPending = 0;
+            for (uint32_t i = 0; i < NUM_INTERRUPTS; i++) {
+                if (!InterruptPending[i]) continue;
+                InterruptPending[i] = 0;
+                InterruptsDisabled = 1;
+                InInterrupt = 1;
+                HostPort_NVIC_INT_CTRL = (HostPort_NVIC_INT_CTRL & ~NVIC_INT_CTRL_VEC_ACT_M) | i;
+                if (Vectors[i]) Vectors[i]();
+                HostPort_NVIC_INT_CTRL &= ~NVIC_INT_CTRL_VEC_ACT_M;
+                InInterrupt = 0;
+                InterruptsDisabled = 0;
+            }
+        }
+        if (PendSVPending) PendSV_Handler();
+    }
+    return;
+}
+
+// SysTickSignal
+// SIGALRM handler, the systick wrapped.
+// Return: void
+static void SysTickSignal(int sig) {
+    (void)sig;
+    HostPort_NVIC_ST_CTRL |= NVIC_ST_CTRL_COUNT;
+    if (SysTickEnabled && ArmedPeriod != SysTickPeriod) ArmSysTick(SysTickPeriod);
+    if (!SysTickInterruptEnabled) return;
+    InterruptPending[FAULT_SYSTICK] = 1;
+    AnyInterruptPending = 1;
+    RunPendingInterrupts();
+    return;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// PendSV_Handler
+// Switches to the thread picked by G8RTOS_Scheduler.
+// Return: void
+void PendSV_Handler(void) {
+    PendSVPending = 0;
+    tcb_t* previous = CurrentlyRunningThread;
+    sig_atomic_t disabled = InterruptsDisabled;
+    InterruptsDisabled = 1;
+    // A thread that killed itself may already have had its TCB reinitialized.
+    hostThread_t* host = HostThreadOf(previous);
+    ucontext_t* from = &host->context;
+    if (host->tcb != previous || previous->stackPointer[INITIAL_R4_OFFSET] == INITIAL_R4) from = &DeadContext;
+    G8RTOS_Scheduler();
+    if (CurrentlyRunningThread != previous || from == &DeadContext) {
+        HostPort_ContextSwitches++;
+        swapcontext(from, ContextOf(CurrentlyRunningThread));
+    }
+    InterruptsDisabled = disabled;
+    return;
+}
+
+// HostPort_PendSV
+// Called when the kernel sets NVIC_INT_CTRL_PEND_SV.
+// Return: void
+void HostPort_PendSV(void) {
+    PendSVPending = 1;
+    RunPendingInterrupts();
+    return;
+}
+
+// HostPort_RaiseInterrupt
+// Pends a peripheral interrupt registered with IntRegister, e.g. through
+// G8RTOS_Add_APeriodicEvent. It is taken at once if interrupts are enabled.
+// Param uint32_t "IRQn": vector table index
+// Return: void
+void HostPort_RaiseInterrupt(uint32_t IRQn) {
+    if (IRQn >= NUM_INTERRUPTS || !InterruptEnabled[IRQn]) return;
+    int32_t IBit_State = StartCriticalSection();
+    InterruptPending[IRQn] = 1;
+    AnyInterruptPending = 1;
+    EndCriticalSection(IBit_State);
+    return;
+}
+
+// HostPort_GetTimeNs
+// Return: uint64_t, monotonic host time in nanoseconds
+uint64_t HostPort_GetTimeNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// HostPort_CycleCount
+// Return: uint32_t, host time in cycles of the simulated HOST_CLOCK_HZ clock
+uint32_t HostPort_CycleCount(void) {
+    return (uint32_t)(HostPort_GetTimeNs() * (HOST_CLOCK_HZ / 1000000) / 1000);
+}
+
+// StartCriticalSection
+// Return: int32_t, the previous interrupt mask
+int32_t StartCriticalSection(void) {
+    int32_t IBit_State = InterruptsDisabled;
+    InterruptsDisabled = 1;
+    __asm__ volatile ("" ::: "memory");
+    return IBit_State;
+}
+
+// EndCriticalSection
+// Param int32_t "IBit_State": interrupt mask returned by StartCriticalSection
+// Return: void
+void EndCriticalSection(int32_t IBit_State) {
+    __asm__ volatile ("" ::: "memory");
+    InterruptsDisabled = IBit_State;
+    if (!IBit_State) RunPendingInterrupts();
+    return;
+}
+
+// CompareAndSwap
+// Replaces *value with "desired" if it still holds "expected". The kernel
+// runs on one host thread, so this only has to be atomic with respect to the
+// timer signal: on x86 a cmpxchg without the bus lock is, like LDREX/STREX
+// on the target, and costs no more than the software interrupt mask.
+// Param int32_t* "value": value to update
+// Param int32_t* "expected": value last read, updated on failure
+// Param int32_t "desired": new value
+// Return: bool, true if *value was replaced
+static inline bool CompareAndSwap(int32_t* value, int32_t* expected, int32_t desired) {
+#if defined(__x86_64__) || defined(__i386__)
+    bool swapped;
+    __asm__ volatile ("cmpxchgl %3, %1\n\tsete %0"
+                      : "=q" (swapped), "+m" (*value), "+a" (*expected)
+                      : "r" (desired)
+                      : "memory", "cc");
+    return swapped;
+#else
+    return __atomic_compare_exchange_n(value, expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+// AtomicTryDecrement
+// Param int32_t* "value": value to decrement if positive
+// Return: bool, true if it was decremented
+bool AtomicTryDecrement(int32_t* value) {
+    int32_t current = *(volatile int32_t*)value;
+    while (current > 0) {
+        if (CompareAndSwap(value, &current, current - 1)) return true;
+    }
+    return false;
+}
+
+// AtomicTryIncrement
+// Param int32_t* "value": value to increment if not negative
+// Return: bool, true if it was incremented
+bool AtomicTryIncrement(int32_t* value) {
+    int32_t current = *(volatile int32_t*)value;
+    while (current >= 0) {
+        if (CompareAndSwap(value, &current, current + 1)) return true;
+    }
+    return false;
+}
+
+// G8RTOS_Start
+// Switches to the first thread. Does not return.
+// Return: void
+void G8RTOS_Start(void) {
+    if ((uintptr_t)&G8RTOS_Start > UINT32_MAX) {
+        fprintf(stderr, "G8RTOS: code above 4 GiB, link the host port with -no-pie\n");
+        abort();
+    }
+    ucontext_t discarded;
+    swapcontext(&discarded, ContextOf(CurrentlyRunningThread));
+    abort();
+}
+
+/********************************Public Functions***********************************/
+
+/*******************************Driverlib Functions*********************************/
+
+void SysTickEnable(void) {
+    if (SysTickEnabled) return;
+    // A write to NVIC_ST_CURRENT clears the counter and the count flag.
+    if (HostPort_NVIC_ST_CURRENT == 0) {
+        HostPort_NVIC_ST_CTRL &= ~NVIC_ST_CTRL_COUNT;
+        HostPort_NVIC_ST_CURRENT = SysTickPeriod;
+    }
+    SysTickEnabled = true;
+    ArmSysTick(HostPort_NVIC_ST_CURRENT);
+    return;
+}
+
+void SysTickDisable(void) {
+    if (!SysTickEnabled) return;
+    HostPort_NVIC_ST_CURRENT = SysTickValueGet();
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    timer_settime(SysTickTimer, 0, &its, NULL);
+    SysTickEnabled = false;
+    return;
+}
+
+void SysTickIntRegister(void (*pfnHandler)(void)) {
+    static bool created;
+    Vectors[FAULT_SYSTICK] = pfnHandler;
+    if (created) return;
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SysTickSignal;
+    sigaction(SIGALRM, &action, NULL);
+    struct sigevent event;
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGALRM;
+    timer_create(CLOCK_MONOTONIC, &event, &SysTickTimer);
+    created = true;
+    return;
+}
+
+void SysTickIntEnable(void) {
+    SysTickInterruptEnabled = true;
+    return;
+}
+
+void SysTickPeriodSet(uint32_t ui32Period) {
+    SysTickPeriod = ui32Period;
+    return;
+}
+
+uint32_t SysTickPeriodGet(void) {
+    return SysTickPeriod;
+}
+
+uint32_t SysTickValueGet(void) {
+    if (!SysTickEnabled) return HostPort_NVIC_ST_CURRENT;
+    struct itimerspec its;
+    timer_gettime(SysTickTimer, &its);
+    uint64_t ns = (uint64_t)its.it_value.tv_sec * 1000000000ull + (uint64_t)its.it_value.tv_nsec;
+    uint32_t value = (uint32_t)(ns * HOST_CLOCK_HZ / 1000000000ull);
+    return value ? value : 1;
+}
+
+uint32_t SysCtlClockGet(void) {
+    return HOST_CLOCK_HZ;
+}
+
+void FPUEnable(void) {
+    return;
+}
+
+void FPULazyStackingEnable(void) {
+    return;
+}
+
+// WFI with interrupts masked: returns once an interrupt is pending.
+void SysCtlSleep(void) {
+    sigset_t alarm, previous;
+    sigemptyset(&alarm);
+    sigaddset(&alarm, SIGALRM);
+    sigprocmask(SIG_BLOCK, &alarm, &previous);
+    if (!AnyInterruptPending && !PendSVPending) sigsuspend(&previous);
+    sigprocmask(SIG_SETMASK, &previous, NULL);
+    return;
+}
+
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void)) {
+    if (ui32Interrupt < NUM_INTERRUPTS) Vectors[ui32Interrupt] = pfnHandler;
+    return;
+}
+
+void IntEnable(uint32_t ui32Interrupt) {
+    if (ui32Interrupt < NUM_INTERRUPTS) InterruptEnabled[ui32Interrupt] = true;
+    return;
+}
+
+// Interrupt priorities are not modelled.
+void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority) {
+    (void)ui32Interrupt;
+    (void)ui8Priority;
+    return;
+}
+
+// PRIMASK and BASEPRI are not modelled separately: the software interrupt
+// mask stands for both and is left to the critical sections.
+void IntPriorityMaskSet(uint32_t ui32PriorityMask) {
+    (void)ui32PriorityMask;
+    return;
+}
+
+bool IntMasterEnable(void) {
+    return InterruptsDisabled;
+}
+
+bool IntMasterDisable(void) {
+    return InterruptsDisabled;
+}
+
+/*******************************Driverlib Functions*********************************/
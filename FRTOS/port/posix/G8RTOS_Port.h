@@ -0,0 +1,59 @@
+// G8RTOS_Port.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// POSIX host port. Runs the unmodified kernel sources as a single Linux
+// process so they can be debugged and benchmarked off target.
+//
+// - Threads are ucontext_t contexts, each with its own host stack. The
+//   stacks carved from the kernel's stack arena are still set up by
+//   G8RTOS_AddThread but only carry the thread's entry point.
+// - Interrupts are masked by a software flag, so StartCriticalSection and
+//   EndCriticalSection cost a load and a store, as CPSID / CPSIE do.
+// - The systick is a POSIX timer delivering SIGALRM. A tick that arrives
+//   inside a critical section stays pending until EndCriticalSection.
+// - PendSV runs as soon as it is pended and interrupts are enabled.
+//   Peripheral interrupts can be raised with HostPort_RaiseInterrupt and are
+//   taken in order of IRQ number, before PendSV.
+//
+// The kernel keeps code addresses in 32-bit stack words, so the port must be
+// linked as a non-PIE executable. Kernel threads can be preempted anywhere,
+// so only one of them should call into non-reentrant libc (e.g. stdio).
+
+#ifndef G8RTOS_PORT_H_
+#define G8RTOS_PORT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Simulated core clock, as returned by SysCtlClockGet
+#ifndef HOST_CLOCK_HZ
+#define HOST_CLOCK_HZ       16000000
+#endif
+
+// Host stack size for each thread
+#ifndef HOST_STACK_SIZE
+#define HOST_STACK_SIZE     (256 * 1024)
+#endif
+
+/*************************************Defines***************************************/
+
+/********************************Public Variables***********************************/
+
+// Number of PendSV calls that switched to another thread
+extern volatile uint32_t HostPort_ContextSwitches;
+
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void HostPort_RaiseInterrupt(uint32_t IRQn);
+uint64_t HostPort_GetTimeNs(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_PORT_H_ */
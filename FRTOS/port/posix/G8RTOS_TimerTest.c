@@ -0,0 +1,120 @@
+// G8RTOS_TimerTest.c
+// Date Created: 2026-10-17
+// Date Updated: 2026-10-17
+// Host test for software timers started again while they are on the due
+// list: from a thread that outranks the timer daemon, from an interrupt
+// handler, and from the timer's own callback. Each timer must keep firing
+// once per period and stop for good when stopped. Exits 0 on success.
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "G8RTOS.h"
+#include "G8RTOS_Port.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define TEST_PRIORITY           0       // Above TIMER_DAEMON_PRIORITY
+#define TEST_THREAD_ID          1
+#define IDLE_THREAD_ID_TEST     2
+#define TEST_IRQ                40
+#define TIMER_PERIOD            10
+#define RUN_TICKS               200
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+static G8RTOS_Timer_t ThreadTimer;
+static G8RTOS_Timer_t ISRTimer;
+static G8RTOS_Timer_t CallbackTimer;
+static volatile uint32_t ThreadCount;
+static volatile uint32_t ISRCount;
+static volatile uint32_t CallbackCount;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+static void ThreadTimerCallback(G8RTOS_Timer_t* timer) {
+    ThreadCount++;
+}
+
+static void ISRTimerCallback(G8RTOS_Timer_t* timer) {
+    ISRCount++;
+}
+
+static void CallbackTimerCallback(G8RTOS_Timer_t* timer) {
+    CallbackCount++;
+    G8RTOS_StartTimer(timer);
+}
+
+static void TestIRQHandler(void) {
+    G8RTOS_StartTimerFromISR(&ISRTimer);
+    G8RTOS_ExitISR();
+}
+
+// Check
+// Prints a failed condition and exits.
+// Return: void
+static void Check(bool condition, char* what) {
+    if (condition) return;
+    printf("FAIL: %s\n", what);
+    exit(1);
+}
+
+static void TestThread(void) {
+    // Sleeping one period wakes this thread on the tick the timer expires,
+    // ahead of the daemon, while the timer is on the due list.
+    G8RTOS_StartTimer(&ThreadTimer);
+    sleep(TIMER_PERIOD);
+    Check(ThreadTimer.isDue, "thread timer due");
+    G8RTOS_StartTimer(&ThreadTimer);
+
+    G8RTOS_StartTimer(&ISRTimer);
+    sleep(TIMER_PERIOD);
+    Check(ISRTimer.isDue, "ISR timer due");
+    HostPort_RaiseInterrupt(TEST_IRQ);
+
+    G8RTOS_StartTimer(&CallbackTimer);
+    sleep(RUN_TICKS);
+
+    G8RTOS_StopTimer(&ThreadTimer);
+    G8RTOS_StopTimer(&ISRTimer);
+    G8RTOS_StopTimer(&CallbackTimer);
+    uint32_t threadCount = ThreadCount;
+    uint32_t isrCount = ISRCount;
+    uint32_t callbackCount = CallbackCount;
+    Check(threadCount >= RUN_TICKS / TIMER_PERIOD, "thread timer kept firing");
+    Check(isrCount >= RUN_TICKS / TIMER_PERIOD, "ISR timer kept firing");
+    Check(callbackCount >= RUN_TICKS / TIMER_PERIOD - 1, "callback timer kept firing");
+
+    sleep(RUN_TICKS);
+    Check(ThreadCount == threadCount && ISRCount == isrCount && CallbackCount == callbackCount, "timers stopped");
+    Check(!G8RTOS_TimerIsActive(&ThreadTimer) && !G8RTOS_TimerIsActive(&ISRTimer) &&
+          !G8RTOS_TimerIsActive(&CallbackTimer), "timers inactive");
+    printf("PASS\n");
+    exit(0);
+}
+
+static void IdleThread(void) {
+    while (1);
+}
+
+/*******************************Private Functions***********************************/
+
+int main(void) {
+    G8RTOS_Init();
+    G8RTOS_InitTimer(&ThreadTimer, ThreadTimerCallback, TIMER_PERIOD, true, NULL);
+    G8RTOS_InitTimer(&ISRTimer, ISRTimerCallback, TIMER_PERIOD, true, NULL);
+    G8RTOS_InitTimer(&CallbackTimer, CallbackTimerCallback, TIMER_PERIOD, true, NULL);
+    G8RTOS_AddThread(TestThread, TEST_PRIORITY, "timer test", TEST_THREAD_ID, STACKSIZE);
+    G8RTOS_AddThread(IdleThread, IDLE_PRIORITY, "idle", IDLE_THREAD_ID_TEST, MIN_STACKSIZE);
+    G8RTOS_Add_APeriodicEvent(TestIRQHandler, HWI_PRIORITY_LOWEST, TEST_IRQ);
+    G8RTOS_Launch();
+    return 1;
+}
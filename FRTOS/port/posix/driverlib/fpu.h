@@ -0,0 +1,13 @@
+// fpu.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host port stand-in for the TivaWare driverlib header of the same name.
+// Host threads keep their floating-point state in their ucontext.
+
+#ifndef __DRIVERLIB_FPU_H__
+#define __DRIVERLIB_FPU_H__
+
+extern void FPUEnable(void);
+extern void FPULazyStackingEnable(void);
+
+#endif // __DRIVERLIB_FPU_H__
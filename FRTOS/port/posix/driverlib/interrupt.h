@@ -0,0 +1,19 @@
+// interrupt.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host port stand-in for the TivaWare driverlib header of the same name.
+
+#ifndef __DRIVERLIB_INTERRUPT_H__
+#define __DRIVERLIB_INTERRUPT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void));
+extern void IntEnable(uint32_t ui32Interrupt);
+extern void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority);
+extern void IntPriorityMaskSet(uint32_t ui32PriorityMask);
+extern bool IntMasterEnable(void);
+extern bool IntMasterDisable(void);
+
+#endif // __DRIVERLIB_INTERRUPT_H__
@@ -0,0 +1,14 @@
+// sysctl.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host port stand-in for the TivaWare driverlib header of the same name.
+
+#ifndef __DRIVERLIB_SYSCTL_H__
+#define __DRIVERLIB_SYSCTL_H__
+
+#include <stdint.h>
+
+extern uint32_t SysCtlClockGet(void);
+extern void SysCtlSleep(void);
+
+#endif // __DRIVERLIB_SYSCTL_H__
@@ -0,0 +1,13 @@
+// hw_ints.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host port stand-in for the TivaWare header of the same name.
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+#define FAULT_PENDSV            14          // PendSV
+#define FAULT_SYSTICK           15          // System Tick
+#define NUM_INTERRUPTS          155         // Vector table entries, as on the TM4C123
+
+#endif // __HW_INTS_H__
@@ -0,0 +1,10 @@
+// hw_memmap.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host port stand-in for the TivaWare header of the same name.
+// There is no peripheral memory map on the host.
+
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+#endif // __HW_MEMMAP_H__
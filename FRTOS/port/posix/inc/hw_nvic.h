@@ -0,0 +1,35 @@
+// hw_nvic.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host port stand-in for the TivaWare header of the same name.
+// The registers the kernel touches are host variables owned by
+// G8RTOS_Port.c. Setting the PendSV bit has to switch threads right
+// away, as it does on the M4, so NVIC_INT_CTRL_PEND_SV evaluates to a
+// call into the port before yielding the bit value.
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+
+#include <stdint.h>
+
+extern volatile uint32_t HostPort_NVIC_INT_CTRL;
+extern volatile uint32_t HostPort_NVIC_VTABLE;
+extern volatile uint32_t HostPort_NVIC_ST_CTRL;
+extern volatile uint32_t HostPort_NVIC_ST_CURRENT;
+extern void HostPort_PendSV(void);
+extern uint32_t HostPort_CycleCount(void);
+
+#define NVIC_INT_CTRL           ((uintptr_t)&HostPort_NVIC_INT_CTRL)
+#define NVIC_VTABLE             ((uintptr_t)&HostPort_NVIC_VTABLE)
+#define NVIC_ST_CTRL            ((uintptr_t)&HostPort_NVIC_ST_CTRL)
+#define NVIC_ST_CURRENT         ((uintptr_t)&HostPort_NVIC_ST_CURRENT)
+
+#define NVIC_INT_CTRL_PEND_SV   (HostPort_PendSV(), 0x10000000)
+#define NVIC_ST_CTRL_COUNT      0x00010000  // Count Flag
+#define NVIC_INT_CTRL_VEC_ACT_M 0x000000FF  // Active Vector, set while the port runs a handler
+
+// Cycle counter in cycles of the simulated clock
+#define CYCLE_COUNT()           HostPort_CycleCount()
+#define CYCLE_COUNT_INIT()
+
+#endif // __HW_NVIC_H__
@@ -0,0 +1,647 @@
+// G8RTOS_CycleBenchmarks.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Kernel micro-benchmarks timed with the DWT cycle counter. Each benchmark is
+// swept over a number of extra threads, up to as many as MAX_THREADS leaves
+// room for, and reports min/avg/max cycles through semihosting, e.g.
+//   qemu-system-arm -M mps2-an386 -nographic -semihosting -icount shift=5 -kernel g8rtos_cycle_benchmarks
+//
+// QEMU does not model the DWT, so when CYCCNT does not count the CMSDK timer
+// of the MPS2 board is used instead. Under -icount its ticks track executed
+// instructions, which makes runs repeatable enough to compare between builds.
+//
+// The priority 0 interrupt latency is measured with a second board timer
+// whose handler never calls the kernel; configure with
+// -DG8RTOS_KERNEL_BASEPRI=ON to compare BASEPRI against PRIMASK masking.
+//
+// Priority inversion is timed once, with the lock a mutex and then a binary
+// semaphore, which lends no priority to its holder.
+//
+// The last row counts the systick interrupts taken while every thread sleeps
+// for IDLE_COUNT_MS. Configure with -DG8RTOS_TICKLESS_IDLE=ON to check that
+// tickless idle cuts them to a few; the benchmarks then exit with status 1 if
+// it does not.
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "G8RTOS.h"
+
+#include "inc/hw_types.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DWT_CTRL                0xE0001000
+#define DWT_CYCCNT              0xE0001004
+#define DWT_CTRL_CYCCNTENA      0x00000001
+#define NVIC_DBG_INT_TRCENA     0x01000000
+
+#define TIMER_CTRL              (TIMER0_BASE + 0x0)
+#define TIMER_VALUE             (TIMER0_BASE + 0x4)
+#define TIMER_RELOAD            (TIMER0_BASE + 0x8)
+
+#define LATENCY_TIMER_CTRL      (TIMER1_BASE + 0x0)
+#define LATENCY_TIMER_VALUE     (TIMER1_BASE + 0x4)
+#define LATENCY_TIMER_RELOAD    (TIMER1_BASE + 0x8)
+#define LATENCY_TIMER_INTCLEAR  (TIMER1_BASE + 0xC)
+#define TIMER_CTRL_ENABLE       0x1
+#define TIMER_CTRL_INTEN        0x8
+
+#define BENCH_PRIORITY          0
+#define IRQ_THREAD_PRIORITY     1
+#define WORKER_PRIORITY         2
+#define LOW_WORKER_PRIORITY     3
+#define INVERSION_LOW_PRIORITY  4
+#define LOAD_PRIORITY           200
+#define IDLE_PRIORITY_BENCH     254
+
+#define BENCH_THREAD_ID         0
+#define WORKER_1_ID             1
+#define WORKER_2_ID             2
+#define WORKER_3_ID             3
+#define LOAD_THREAD_ID          10
+#define IDLE_THREAD_ID_BENCH    200
+
+#define BENCH_STACKSIZE         1024    // printf needs the room
+#define WORKER_STACKSIZE        128
+#define LOAD_STACKSIZE          64
+
+#define BENCH_IRQ               (16 + 30) // External interrupt no device uses
+#define BENCH_IRQ_PRIORITY      1
+#define LATENCY_IRQ             (16 + 9)  // CMSDK timer 1
+#define LATENCY_IRQ_PRIORITY    0         // Above OSINT_PRIORITY, never calls the kernel
+#define LATENCY_PERIOD          997       // Timer ticks, prime so it lands all over the kernel
+
+// Threads left for load once the benchmark, idle, worker and kernel threads are added
+#define MAX_LOAD_THREADS        (MAX_THREADS - 5 - SOFTWARE_TIMERS - DEFERRED_WORK - PERIODIC_DEFERRED)
+
+#define SAMPLES                 1000
+// Priority inversion: the low thread holds the lock for INVERSION_HOLD_TICKS
+// while the medium thread spins for INVERSION_SPIN_TICKS
+#define INVERSION_TRIALS        20
+#define INVERSION_HOLD_TICKS    3
+#define INVERSION_SPIN_TICKS    20
+#define IDLE_COUNT_MS           1000
+#define FIFO_INDEX              0
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef struct benchStats_t {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+} benchStats_t;
+
+/******************************Data Type Definitions********************************/
+
+/********************************Private Variables**********************************/
+
+// Extra thread counts each benchmark is swept over
+static const uint32_t ThreadCounts[] = { 0, 4, 8, 16, MAX_LOAD_THREADS };
+
+static uint32_t (*ReadCycles)(void);
+
+static benchStats_t Stats;
+static benchStats_t LatencyStats;
+static semaphore_t Done;
+static semaphore_t Ping;
+static semaphore_t Pong;
+static semaphore_t Wake;
+static volatile uint32_t StartStamp;
+static volatile bool TimingSysTick;
+static volatile uint32_t SysTickCount;
+static volatile float FPUWork;
+static volatile bool NotifyIRQ;
+
+// Lock the inversion threads share: a mutex, or a binary semaphore when
+// UseInheritance is false
+static G8RTOS_Mutex_t InversionMutex;
+static semaphore_t InversionSemaphore;
+static volatile bool UseInheritance;
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+static uint32_t DWTCycles(void) {
+    return HWREG(DWT_CYCCNT);
+}
+
+// The CMSDK timer counts down.
+static uint32_t TimerCycles(void) {
+    return ~HWREG(TIMER_VALUE);
+}
+
+// InitCycleCounter
+// Starts the DWT cycle counter, falling back to a free-running board timer
+// when CYCCNT does not count.
+// Return: void
+static void InitCycleCounter(void) {
+    HWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    HWREG(DWT_CYCCNT) = 0;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+    uint32_t start = DWTCycles();
+    for (volatile uint32_t i = 0; i < 100; i++);
+    if (DWTCycles() != start) {
+        ReadCycles = DWTCycles;
+        printf("timing with DWT CYCCNT\n");
+        return;
+    }
+    HWREG(TIMER_RELOAD) = 0xFFFFFFFF;
+    HWREG(TIMER_VALUE) = 0xFFFFFFFF;
+    HWREG(TIMER_CTRL) = 1;
+    ReadCycles = TimerCycles;
+    printf("no DWT CYCCNT, timing with CMSDK timer 0\n");
+    return;
+}
+
+static void ClearStats(benchStats_t* stats) {
+    stats->min = UINT32_MAX;
+    stats->max = 0;
+    stats->sum = 0;
+    stats->count = 0;
+    return;
+}
+
+static void ResetStats(void) {
+    ClearStats(&Stats);
+    return;
+}
+
+static void RecordInto(benchStats_t* stats, uint32_t cycles) {
+    if (cycles < stats->min) stats->min = cycles;
+    if (cycles > stats->max) stats->max = cycles;
+    stats->sum += cycles;
+    stats->count++;
+    return;
+}
+
+static void Record(uint32_t cycles) {
+    RecordInto(&Stats, cycles);
+    return;
+}
+
+static void Report(char* name, uint32_t threads) {
+    if (Stats.count == 0) {
+        printf("%-32s %2lu threads  no samples\n", name, (unsigned long)threads);
+        return;
+    }
+    printf("%-32s %2lu threads  min %7lu  avg %7lu  max %7lu cycles\n", name, (unsigned long)threads,
+           (unsigned long)Stats.min, (unsigned long)(Stats.sum / Stats.count), (unsigned long)Stats.max);
+    return;
+}
+
+#if !TICKLESS_IDLE
+static void IdleThread(void) {
+    while (1);
+}
+#endif
+
+static void LoadThread(void) {
+    while (1);
+}
+
+static void SleeperThread(void) {
+    while (1) sleep(1000000);
+}
+
+static void TickSleeperThread(void) {
+    while (1) sleep(1);
+}
+
+// AddLoad
+// Adds "threads" extra threads running "thread" at LOAD_PRIORITY.
+// Return: void
+static void AddLoad(void (*thread)(void), uint32_t threads) {
+    for (uint32_t i = 0; i < threads; i++) {
+        G8RTOS_AddThread(thread, LOAD_PRIORITY, "load", LOAD_THREAD_ID + i, LOAD_STACKSIZE);
+    }
+    return;
+}
+
+static void RemoveLoad(uint32_t threads) {
+    for (uint32_t i = 0; i < threads; i++) G8RTOS_KillThread(LOAD_THREAD_ID + i);
+    return;
+}
+
+// RunWorkers
+// Runs one or two worker threads until each has signalled Done.
+// Return: void
+static void RunWorkers(void (*first)(void), uint8_t firstPriority, void (*second)(void), uint8_t secondPriority) {
+    G8RTOS_AddThread(first, firstPriority, "worker 1", WORKER_1_ID, WORKER_STACKSIZE);
+    if (second) G8RTOS_AddThread(second, secondPriority, "worker 2", WORKER_2_ID, WORKER_STACKSIZE);
+    G8RTOS_WaitSemaphore(&Done);
+    if (second) G8RTOS_WaitSemaphore(&Done);
+    // A worker preempted between signalling Done and killing itself still
+    // holds its ID, so finish it off before the IDs are reused.
+    G8RTOS_KillThread(WORKER_1_ID);
+    if (second) G8RTOS_KillThread(WORKER_2_ID);
+    return;
+}
+
+/*******************************Context Switch**************************************/
+
+// Woken by SwitchLow, measures from the PendSV request to its first instruction.
+static void SwitchHigh(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        G8RTOS_WaitSemaphore(&Wake);
+        Record(ReadCycles() - StartStamp);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void SwitchLow(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        // Signal only readies SwitchHigh, the switch happens on the PendSV below.
+        G8RTOS_SignalSemaphore(&Wake);
+        StartStamp = ReadCycles();
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Same as SwitchHigh/SwitchLow, but both threads use the FPU, so PendSV
+// also saves and restores their floating-point registers.
+static void SwitchHighFPU(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        G8RTOS_WaitSemaphore(&Wake);
+        Record(ReadCycles() - StartStamp);
+        FPUWork = FPUWork * 0.5f + 1.0f;
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void SwitchLowFPU(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        FPUWork = FPUWork * 0.5f + 1.0f;
+        G8RTOS_SignalSemaphore(&Wake);
+        StartStamp = ReadCycles();
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+/*******************************Semaphore Ping-Pong*********************************/
+
+static void PingThread(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        uint32_t start = ReadCycles();
+        G8RTOS_SignalSemaphore(&Ping);
+        G8RTOS_WaitSemaphore(&Pong);
+        Record(ReadCycles() - start);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void PongThread(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        G8RTOS_WaitSemaphore(&Ping);
+        G8RTOS_SignalSemaphore(&Pong);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void NotifyPingThread(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        uint32_t start = ReadCycles();
+        G8RTOS_NotifyGive(WORKER_2_ID);
+        G8RTOS_NotifyTake(false);
+        Record(ReadCycles() - start);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void NotifyPongThread(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        G8RTOS_NotifyTake(false);
+        G8RTOS_NotifyGive(WORKER_1_ID);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+/*************************************FIFO******************************************/
+
+static void FIFOProducer(void) {
+    for (int32_t i = 0; i < SAMPLES; i++) G8RTOS_WriteFIFO(FIFO_INDEX, i);
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Times each read, including the switches to the producer when the FIFO is empty.
+static void FIFOConsumer(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        uint32_t start = ReadCycles();
+        G8RTOS_ReadFIFO(FIFO_INDEX);
+        Record(ReadCycles() - start);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+/*************************************SysTick***************************************/
+
+// Stands in for SysTick_Handler in the vector table, timing it while
+// TimingSysTick is set and counting every interrupt.
+static void TimedSysTick(void) {
+    uint32_t start = ReadCycles();
+    SysTickCount++;
+    SysTick_Handler();
+    if (TimingSysTick) Record(ReadCycles() - start);
+    return;
+}
+
+/******************************Interrupt to Thread**********************************/
+
+// The woken thread outranks IRQTrigger, so G8RTOS_ExitISR pends the switch.
+static void BenchIRQHandler(void) {
+    if (NotifyIRQ) G8RTOS_NotifyGiveFromISR(WORKER_1_ID);
+    else G8RTOS_SignalSemaphoreFromISR(&Wake);
+    G8RTOS_ExitISR();
+    return;
+}
+
+// Measures from raising BENCH_IRQ to the first instruction of the woken thread.
+static void IRQThread(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        G8RTOS_WaitSemaphore(&Wake);
+        Record(ReadCycles() - StartStamp);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void NotifyIRQThread(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        G8RTOS_NotifyTake(false);
+        Record(ReadCycles() - StartStamp);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+static void IRQTrigger(void) {
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        StartStamp = ReadCycles();
+        HWREG(NVIC_PEND0 + ((BENCH_IRQ - 16) / 32) * 4) = 1 << ((BENCH_IRQ - 16) % 32);
+    }
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+/*******************************Priority Inversion**********************************/
+
+static void AcquireInversionLock(void) {
+    if (UseInheritance) G8RTOS_LockMutex(&InversionMutex);
+    else G8RTOS_WaitSemaphore(&InversionSemaphore);
+}
+
+static void ReleaseInversionLock(void) {
+    if (UseInheritance) G8RTOS_UnlockMutex(&InversionMutex);
+    else G8RTOS_SignalSemaphore(&InversionSemaphore);
+}
+
+static void SpinTicks(uint32_t ticks) {
+    uint32_t start = G8RTOS_GetSysTime();
+    while (G8RTOS_GetSysTime() - start < ticks);
+}
+
+// Takes the lock first and holds it across the other two waking up
+static void InversionLow(void) {
+    AcquireInversionLock();
+    SpinTicks(INVERSION_HOLD_TICKS);
+    ReleaseInversionLock();
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Wakes while the low thread holds the lock and preempts it unless it inherited
+static void InversionMedium(void) {
+    sleep(2);
+    SpinTicks(INVERSION_SPIN_TICKS);
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// Measures how long it is blocked on the lock.
+static void InversionHigh(void) {
+    sleep(1);
+    uint32_t start = ReadCycles();
+    AcquireInversionLock();
+    Record(ReadCycles() - start);
+    ReleaseInversionLock();
+    G8RTOS_SignalSemaphore(&Done);
+    G8RTOS_KillSelf();
+}
+
+// RunInversion
+// Runs INVERSION_TRIALS rounds of the low, medium and high inversion threads.
+// Param bool "inheritance": lock with a mutex rather than a binary semaphore
+// Return: void
+static void RunInversion(bool inheritance) {
+    UseInheritance = inheritance;
+    for (uint32_t i = 0; i < INVERSION_TRIALS; i++) {
+        G8RTOS_AddThread(InversionHigh, WORKER_PRIORITY, "high", WORKER_1_ID, WORKER_STACKSIZE);
+        G8RTOS_AddThread(InversionMedium, LOW_WORKER_PRIORITY, "medium", WORKER_2_ID, WORKER_STACKSIZE);
+        G8RTOS_AddThread(InversionLow, INVERSION_LOW_PRIORITY, "low", WORKER_3_ID, WORKER_STACKSIZE);
+        for (uint32_t j = 0; j < 3; j++) G8RTOS_WaitSemaphore(&Done);
+        G8RTOS_KillThread(WORKER_1_ID);
+        G8RTOS_KillThread(WORKER_2_ID);
+        G8RTOS_KillThread(WORKER_3_ID);
+    }
+    return;
+}
+
+/************************High-Priority Interrupt Latency****************************/
+
+// Stands in for an interrupt above OSINT_PRIORITY, e.g. motor control, that
+// never calls the kernel. Measures how long after the timer expired it ran.
+static void LatencyTimerHandler(void) {
+    RecordInto(&LatencyStats, HWREG(LATENCY_TIMER_RELOAD) - HWREG(LATENCY_TIMER_VALUE));
+    HWREG(LATENCY_TIMER_INTCLEAR) = 1;
+    return;
+}
+
+static void StartLatencyTimer(void) {
+    ClearStats(&LatencyStats);
+    HWREG(LATENCY_TIMER_RELOAD) = LATENCY_PERIOD;
+    HWREG(LATENCY_TIMER_VALUE) = LATENCY_PERIOD;
+    HWREG(LATENCY_TIMER_CTRL) = TIMER_CTRL_ENABLE | TIMER_CTRL_INTEN;
+    return;
+}
+
+static void StopLatencyTimer(void) {
+    HWREG(LATENCY_TIMER_CTRL) = 0;
+    HWREG(LATENCY_TIMER_INTCLEAR) = 1;
+    return;
+}
+
+/************************************Benchmarks*************************************/
+
+static void BenchThread(void) {
+    uint32_t sweeps = sizeof(ThreadCounts) / sizeof(ThreadCounts[0]);
+
+    InitCycleCounter();
+    G8RTOS_Add_APeriodicEvent(BenchIRQHandler, BENCH_IRQ_PRIORITY, BENCH_IRQ);
+    IntRegister(FAULT_SYSTICK, TimedSysTick);
+    // Not an aperiodic event: under KERNEL_BASEPRI it sits above the kernel.
+    IntRegister(LATENCY_IRQ, LatencyTimerHandler);
+    IntPrioritySet(LATENCY_IRQ, LATENCY_IRQ_PRIORITY << HWI_PRIORITY_SHIFT);
+    IntEnable(LATENCY_IRQ);
+
+    // Uncontended paths, no thread ever blocks
+    ResetStats();
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        uint32_t start = ReadCycles();
+        G8RTOS_SignalSemaphore(&Ping);
+        G8RTOS_WaitSemaphore(&Ping);
+        Record(ReadCycles() - start);
+    }
+    Report("uncontended signal + wait", 0);
+
+    ResetStats();
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        uint32_t start = ReadCycles();
+        G8RTOS_WriteFIFO(FIFO_INDEX, i);
+        G8RTOS_ReadFIFO(FIFO_INDEX);
+        Record(ReadCycles() - start);
+    }
+    Report("uncontended FIFO write + read", 0);
+
+    // Worst-case blocking of a high priority thread behind a low priority lock holder
+    ResetStats();
+    RunInversion(false);
+    Report("priority inversion, semaphore", 0);
+
+    ResetStats();
+    RunInversion(true);
+    Report("priority inversion, mutex", 0);
+
+    for (uint32_t s = 0; s < sweeps; s++) {
+        uint32_t n = ThreadCounts[s];
+        AddLoad(LoadThread, n);
+
+        ResetStats();
+        RunWorkers(SwitchHigh, WORKER_PRIORITY, SwitchLow, LOW_WORKER_PRIORITY);
+        Report("PendSV context switch", n);
+
+        ResetStats();
+        RunWorkers(SwitchHighFPU, WORKER_PRIORITY, SwitchLowFPU, LOW_WORKER_PRIORITY);
+        Report("PendSV context switch, FPU", n);
+
+        ResetStats();
+        RunWorkers(PingThread, WORKER_PRIORITY, PongThread, WORKER_PRIORITY);
+        Report("semaphore ping-pong round", n);
+
+        ResetStats();
+        RunWorkers(NotifyPingThread, WORKER_PRIORITY, NotifyPongThread, WORKER_PRIORITY);
+        Report("notification ping-pong round", n);
+
+        ResetStats();
+        RunWorkers(FIFOProducer, WORKER_PRIORITY, FIFOConsumer, WORKER_PRIORITY);
+        Report("FIFO read, producer/consumer", n);
+
+        ResetStats();
+        RunWorkers(IRQThread, IRQ_THREAD_PRIORITY, IRQTrigger, LOW_WORKER_PRIORITY);
+        Report("interrupt to thread latency", n);
+
+        ResetStats();
+        NotifyIRQ = true;
+        RunWorkers(NotifyIRQThread, IRQ_THREAD_PRIORITY, IRQTrigger, LOW_WORKER_PRIORITY);
+        NotifyIRQ = false;
+        Report("interrupt to thread, notification", n);
+
+        // Kernel-heavy load while the latency timer fires
+        StartLatencyTimer();
+        RunWorkers(PingThread, WORKER_PRIORITY, PongThread, WORKER_PRIORITY);
+        RunWorkers(FIFOProducer, WORKER_PRIORITY, FIFOConsumer, WORKER_PRIORITY);
+        RunWorkers(IRQThread, IRQ_THREAD_PRIORITY, IRQTrigger, LOW_WORKER_PRIORITY);
+        StopLatencyTimer();
+        Stats = LatencyStats;
+        Report(KERNEL_BASEPRI ? "priority 0 IRQ latency, BASEPRI" : "priority 0 IRQ latency, PRIMASK", n);
+
+        RemoveLoad(n);
+    }
+
+    for (uint32_t s = 0; s < sweeps; s++) {
+        uint32_t n = ThreadCounts[s];
+
+        AddLoad(SleeperThread, n);
+        sleep(2);
+        ResetStats();
+        TimingSysTick = true;
+        sleep(SAMPLES / 10);
+        TimingSysTick = false;
+        Report("SysTick, sleepers not due", n);
+        RemoveLoad(n);
+
+        AddLoad(TickSleeperThread, n);
+        sleep(2);
+        ResetStats();
+        TimingSysTick = true;
+        sleep(SAMPLES / 10);
+        TimingSysTick = false;
+        Report("SysTick, all sleepers due", n);
+        RemoveLoad(n);
+    }
+
+    // Nothing runs or is due for IDLE_COUNT_MS. The periodic systick fires
+    // once per ms; tickless idle only wakes when the systick counter runs out.
+    sleep(2);
+    SysTickCount = 0;
+    sleep(IDLE_COUNT_MS);
+    uint32_t idleTicks = SysTickCount;
+    printf("%-32s %lu in %lu ms\n", "SysTick interrupts, all asleep", (unsigned long)idleTicks,
+           (unsigned long)IDLE_COUNT_MS);
+#if TICKLESS_IDLE
+    if (idleTicks * 10 >= IDLE_COUNT_MS) {
+        printf("tickless idle did not suppress the systick\n");
+        exit(1);
+    }
+#endif
+
+    exit(0);
+}
+
+/************************************Benchmarks*************************************/
+
+/*******************************Private Functions***********************************/
+
+extern void initialise_monitor_handles(void);
+
+int main(void) {
+    initialise_monitor_handles();
+    G8RTOS_Init();
+    G8RTOS_InitSemaphore(&Done, 0);
+    G8RTOS_InitSemaphore(&Ping, 0);
+    G8RTOS_InitSemaphore(&Pong, 0);
+    G8RTOS_InitSemaphore(&Wake, 0);
+    G8RTOS_InitFIFO(FIFO_INDEX);
+    G8RTOS_InitMutex(&InversionMutex);
+    G8RTOS_InitSemaphore(&InversionSemaphore, 1);
+#if !TICKLESS_IDLE
+    // Tickless idle adds the kernel's own idle thread, which must be the only one
+    G8RTOS_AddThread(IdleThread, IDLE_PRIORITY_BENCH, "idle", IDLE_THREAD_ID_BENCH, LOAD_STACKSIZE);
+#endif
+    G8RTOS_AddThread(BenchThread, BENCH_PRIORITY, "benchmarks", BENCH_THREAD_ID, BENCH_STACKSIZE);
+    G8RTOS_Launch();
+    return 1;
+}
@@ -0,0 +1,151 @@
+// G8RTOS_Driverlib.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// The driverlib calls the kernel makes, implemented on the Cortex-M4 core
+// peripherals (SysTick, NVIC, SCB) so the kernel runs on QEMU's MPS2 AN386
+// board, which has no TM4C123 peripherals. Behaves like TivaWare.
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/systick.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/fpu.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// FPU control registers of the System Control Block
+#define NVIC_CPAC           0xE000ED88  // Coprocessor Access Control
+#define NVIC_FPCC           0xE000EF34  // Floating-Point Context Control
+#define NVIC_CPAC_CP11_FULL 0x00C00000
+#define NVIC_CPAC_CP10_FULL 0x00300000
+#define NVIC_FPCC_ASPEN     0x80000000  // Automatic state preservation
+#define NVIC_FPCC_LSPEN     0x40000000  // Lazy state preservation
+
+// Core clock of the MPS2 AN386 board
+#define QEMU_CLOCK_HZ       25000000
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+// RAM vector table. VTOR needs it aligned to its size rounded up to a power of two.
+static __attribute__((aligned(1024))) void (*RAMVectors[NUM_INTERRUPTS])(void);
+
+/********************************Private Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+void SysTickEnable(void) {
+    HWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_CLK_SRC | NVIC_ST_CTRL_ENABLE;
+    return;
+}
+
+void SysTickDisable(void) {
+    HWREG(NVIC_ST_CTRL) &= ~NVIC_ST_CTRL_ENABLE;
+    return;
+}
+
+void SysTickIntRegister(void (*pfnHandler)(void)) {
+    IntRegister(FAULT_SYSTICK, pfnHandler);
+    HWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_INTEN;
+    return;
+}
+
+void SysTickIntEnable(void) {
+    HWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_INTEN;
+    return;
+}
+
+void SysTickPeriodSet(uint32_t ui32Period) {
+    HWREG(NVIC_ST_RELOAD) = ui32Period - 1;
+    return;
+}
+
+uint32_t SysTickPeriodGet(void) {
+    return HWREG(NVIC_ST_RELOAD) + 1;
+}
+
+uint32_t SysTickValueGet(void) {
+    return HWREG(NVIC_ST_CURRENT);
+}
+
+uint32_t SysCtlClockGet(void) {
+    return QEMU_CLOCK_HZ;
+}
+
+void SysCtlSleep(void) {
+    __asm volatile ("wfi");
+    return;
+}
+
+// Moves the vector table to SRAM on first use.
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void)) {
+    if (HWREG(NVIC_VTABLE) != (uint32_t)RAMVectors) {
+        void (**oldTable)(void) = (void (**)(void))HWREG(NVIC_VTABLE);
+        for (uint32_t i = 0; i < NUM_INTERRUPTS; i++) RAMVectors[i] = oldTable[i];
+        HWREG(NVIC_VTABLE) = (uint32_t)RAMVectors;
+    }
+    RAMVectors[ui32Interrupt] = pfnHandler;
+    return;
+}
+
+void IntEnable(uint32_t ui32Interrupt) {
+    if (ui32Interrupt == FAULT_SYSTICK) {
+        HWREG(NVIC_ST_CTRL) |= NVIC_ST_CTRL_INTEN;
+    } else if (ui32Interrupt >= 16 && ui32Interrupt < NUM_INTERRUPTS) {
+        uint32_t irq = ui32Interrupt - 16;
+        HWREG(NVIC_EN0 + (irq / 32) * 4) = 1 << (irq % 32);
+    }
+    return;
+}
+
+void FPUEnable(void) {
+    HWREG(NVIC_CPAC) |= NVIC_CPAC_CP11_FULL | NVIC_CPAC_CP10_FULL;
+    return;
+}
+
+// Exception entry reserves room for S0-S15 but only saves them if the
+// handler uses the FPU.
+void FPULazyStackingEnable(void) {
+    HWREG(NVIC_FPCC) |= NVIC_FPCC_ASPEN | NVIC_FPCC_LSPEN;
+    return;
+}
+
+// "ui8Priority" is the raw register byte, priority in the upper bits.
+void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority) {
+    if (ui32Interrupt >= 16 && ui32Interrupt < NUM_INTERRUPTS) {
+        HWREGB(NVIC_PRI0 + ui32Interrupt - 16) = ui8Priority;
+    } else if (ui32Interrupt == FAULT_PENDSV || ui32Interrupt == FAULT_SYSTICK) {
+        HWREGB(NVIC_SYS_PRI3 + ui32Interrupt - 12) = ui8Priority;
+    }
+    return;
+}
+
+void IntPriorityMaskSet(uint32_t ui32PriorityMask) {
+    __asm volatile ("msr basepri, %0\n\tisb" :: "r" (ui32PriorityMask) : "memory");
+    return;
+}
+
+// Both return whether interrupts were disabled before.
+bool IntMasterEnable(void) {
+    uint32_t primask;
+    __asm volatile ("mrs %0, primask\n\tcpsie i" : "=r" (primask) :: "memory");
+    return primask & 1;
+}
+
+bool IntMasterDisable(void) {
+    uint32_t primask;
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask & 1;
+}
+
+/********************************Public Functions***********************************/
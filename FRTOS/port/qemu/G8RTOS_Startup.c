@@ -0,0 +1,56 @@
+// G8RTOS_Startup.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Reset handler and boot vector table for QEMU's MPS2 AN386 board. The kernel
+// moves the table to SRAM through IntRegister once it starts.
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+
+/************************************Includes***************************************/
+
+/*******************************Linker Script Symbols*******************************/
+
+extern uint32_t _sidata, _sdata, _edata, _sbss, _ebss, _estack;
+
+/*******************************Linker Script Symbols*******************************/
+
+/********************************Public Functions***********************************/
+
+extern int main(void);
+
+void Reset_Handler(void);
+
+// DefaultHandler
+// Parks the core on an unexpected exception so the debugger can inspect it.
+// Return: void
+static void DefaultHandler(void) {
+    while (1);
+}
+
+__attribute__((section(".isr_vector"), used))
+static void (* const BootVectors[NUM_INTERRUPTS])(void) = {
+    (void (*)(void))&_estack,
+    Reset_Handler,
+    [FAULT_NMI] = DefaultHandler,
+    [FAULT_HARD ... NUM_INTERRUPTS - 1] = DefaultHandler,
+};
+
+// Reset_Handler
+// Enables the FPU, copies .data, clears .bss and runs main. The build is
+// hard-float, so the FPU has to be on before any C code that may use it.
+// Return: void
+void Reset_Handler(void) {
+    HWREG(0xE000ED88) |= 0x00F00000; // CPACR: full access to CP10 and CP11
+    uint32_t* source = &_sidata;
+    for (uint32_t* word = &_sdata; word < &_edata; word++) *word = *source++;
+    for (uint32_t* word = &_sbss; word < &_ebss; word++) *word = 0;
+    main();
+    while (1);
+}
+
+/********************************Public Functions***********************************/
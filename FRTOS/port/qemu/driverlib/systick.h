@@ -0,0 +1,19 @@
+// systick.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// QEMU port stand-in for the TivaWare driverlib header of the same name.
+
+#ifndef __DRIVERLIB_SYSTICK_H__
+#define __DRIVERLIB_SYSTICK_H__
+
+#include <stdint.h>
+
+extern void SysTickEnable(void);
+extern void SysTickDisable(void);
+extern void SysTickIntRegister(void (*pfnHandler)(void));
+extern void SysTickIntEnable(void);
+extern void SysTickPeriodSet(uint32_t ui32Period);
+extern uint32_t SysTickPeriodGet(void);
+extern uint32_t SysTickValueGet(void);
+
+#endif // __DRIVERLIB_SYSTICK_H__
@@ -0,0 +1,16 @@
+// hw_ints.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// QEMU port stand-in for the TivaWare header of the same name.
+// Interrupt numbers are vector table indices, as in TivaWare.
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+#define FAULT_NMI               2           // NMI fault
+#define FAULT_HARD              3           // Hard fault
+#define FAULT_PENDSV            14          // PendSV
+#define FAULT_SYSTICK           15          // System Tick
+#define NUM_INTERRUPTS          155         // Same vector table size as the TM4C123
+
+#endif // __HW_INTS_H__
@@ -0,0 +1,13 @@
+// hw_memmap.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// QEMU port stand-in for the TivaWare header of the same name.
+// Peripherals of the MPS2 AN386 board used by the port.
+
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+#define TIMER0_BASE             0x40000000  // CMSDK APB timer 0
+#define TIMER1_BASE             0x40001000  // CMSDK APB timer 1
+
+#endif // __HW_MEMMAP_H__
@@ -0,0 +1,38 @@
+// hw_nvic.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// QEMU port stand-in for the TivaWare header of the same name.
+// These are architectural Cortex-M4 registers, at the same addresses on
+// the TM4C123 and on the MPS2 AN386 board QEMU models.
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+
+#define NVIC_ST_CTRL            0xE000E010  // SysTick Control and Status
+#define NVIC_ST_RELOAD          0xE000E014  // SysTick Reload Value
+#define NVIC_ST_CURRENT         0xE000E018  // SysTick Current Value
+#define NVIC_EN0                0xE000E100  // Interrupt 0-31 Set Enable
+#define NVIC_PEND0              0xE000E200  // Interrupt 0-31 Set Pending
+#define NVIC_PRI0               0xE000E400  // Interrupt 0-3 Priority
+#define NVIC_INT_CTRL           0xE000ED04  // Interrupt Control and State
+#define NVIC_VTABLE             0xE000ED08  // Vector Table Offset
+#define NVIC_SYS_PRI3           0xE000ED20  // System Handler Priority 3
+#define NVIC_DBG_INT            0xE000EDFC  // Debug Exception and Monitor Control
+
+#define NVIC_ST_CTRL_COUNT      0x00010000  // Count Flag
+#define NVIC_ST_CTRL_CLK_SRC    0x00000004  // Clock Source
+#define NVIC_ST_CTRL_INTEN      0x00000002  // Interrupt Enable
+#define NVIC_ST_CTRL_ENABLE     0x00000001  // Enable
+#define NVIC_INT_CTRL_PEND_SV   0x10000000  // PendSV Set Pending
+#define NVIC_INT_CTRL_VEC_ACT_M 0x000000FF  // Active Vector
+
+// QEMU does not model the DWT, so the cycle counter is the free-running
+// CMSDK timer 0 of the board, which counts down.
+#define CYCLE_COUNT()           (~HWREG(0x40000004))
+#define CYCLE_COUNT_INIT()      do { \
+        HWREG(0x40000008) = 0xFFFFFFFF; \
+        HWREG(0x40000004) = 0xFFFFFFFF; \
+        HWREG(0x40000000) = 1; \
+    } while (0)
+
+#endif // __HW_NVIC_H__
@@ -0,0 +1,15 @@
+// hw_types.h
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// QEMU port stand-in for the TivaWare header of the same name.
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HWREG(x)            (*((volatile uint32_t *)(x)))
+#define HWREGB(x)           (*((volatile uint8_t *)(x)))
+
+#endif // __HW_TYPES_H__
@@ -1,15 +1,57 @@
 ; G8RTOS_CriticalSection.s
 ; Created: 2022-07-26
-; Updated: 2022-07-26
-; Contains assembly functions for entering and ending critical sections.
+; Updated: 2026-10-16
+; Contains assembly functions for entering and ending critical sections,
+; and the exclusive access fast paths that avoid them.
+; Assemble with --asm_define=KERNEL_BASEPRI=1 (and OSINT_PRIORITY if changed)
+; to mask with BASEPRI, matching G8RTOS_Scheduler.h.
 
 	; Functions Defined
 	.def StartCriticalSection, EndCriticalSection
+	.def AtomicTryDecrement, AtomicTryIncrement
+
+	.if !$isdefed("KERNEL_BASEPRI")
+KERNEL_BASEPRI	.set 0
+	.endif
+	.if !$isdefed("OSINT_PRIORITY")
+OSINT_PRIORITY	.set 1
+	.endif
+KERNEL_BASEPRI_CEILING	.set OSINT_PRIORITY << 5
 
 	.thumb		; Set to thumb mode
 	.align 2	; Align by 2 bytes (thumb mode uses allignment by 2 or 4)
 	.text		; Text section
 
+	.if KERNEL_BASEPRI
+
+; Starts a critical section
+; 	- Saves the current BASEPRI
+; 	- Masks interrupts at OSINT_PRIORITY and below, never lowering BASEPRI
+; Returns: The current BASEPRI
+StartCriticalSection:
+	.asmfunc
+
+	MRS R0, BASEPRI					; Save BASEPRI to R0 (Return Register)
+	MOV R1, #KERNEL_BASEPRI_CEILING
+	MSR BASEPRI_MAX, R1				; Raise BASEPRI to the kernel ceiling
+	ISB								; Masked from the next instruction on
+	BX LR							; Return
+
+	.endasmfunc
+
+; Ends a critical Section
+; 	- Restores the state of BASEPRI given an input
+; Param R0: BASEPRI State to update
+EndCriticalSection:
+	.asmfunc
+
+	MSR BASEPRI, R0		; Save R0 (Param) to BASEPRI
+	BX LR				; Return
+
+	.endasmfunc
+
+	.else
+
 ; Starts a critical section
 ; 	- Saves the state of the current PRIMASK (I-bit)
 ; 	- Disables interrupts
@@ -34,4 +76,52 @@ EndCriticalSection:
 
 	.endasmfunc
 
+	.endif
+
+; Decrements a value if it is positive, without masking interrupts.
+; An interrupt or context switch between LDREX and STREX clears the
+; exclusive monitor, so the STREX fails and the value is read again.
+; Param R0: Pointer to the value
+; Returns: 1 if the value was decremented, 0 if it was not positive
+AtomicTryDecrement:
+	.asmfunc
+
+	LDREX R1, [R0]		; Read the value and claim exclusive access
+	CMP R1, #0
+	BLE DecrementFail	; Not positive, leave it alone
+	SUB R1, R1, #1
+	STREX R2, R1, [R0]	; Store only if nothing intervened, R2 = 0 on success
+	CMP R2, #0
+	BNE AtomicTryDecrement ; Lost exclusive access, try again
+	MOV R0, #1
+	BX LR
+DecrementFail:
+	CLREX				; Drop the exclusive access
+	MOV R0, #0
+	BX LR
+
+	.endasmfunc
+
+; Increments a value if it is not negative, without masking interrupts.
+; Param R0: Pointer to the value
+; Returns: 1 if the value was incremented, 0 if it was negative
+AtomicTryIncrement:
+	.asmfunc
+
+	LDREX R1, [R0]		; Read the value and claim exclusive access
+	CMP R1, #0
+	BLT IncrementFail	; Negative, leave it alone
+	ADD R1, R1, #1
+	STREX R2, R1, [R0]	; Store only if nothing intervened, R2 = 0 on success
+	CMP R2, #0
+	BNE AtomicTryIncrement ; Lost exclusive access, try again
+	MOV R0, #1
+	BX LR
+IncrementFail:
+	CLREX				; Drop the exclusive access
+	MOV R0, #0
+	BX LR
+
+	.endasmfunc
+
 ; end G8RTOS_CriticalSection.s
@@ -0,0 +1,88 @@
+// G8RTOS_Deferred.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for deferred interrupt work functions
+
+#include "../G8RTOS_Deferred.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Scheduler.h"
+#include "../G8RTOS_Notify.h"
+
+/********************************Private Variables**********************************/
+
+// Work Queue - ring buffer filled by interrupt handlers and emptied by the worker
+static deferredWork_t WorkQueue[DEFERRED_QUEUE_SIZE];
+static uint32_t WorkHead;   // Items taken, the oldest is at WorkHead % DEFERRED_QUEUE_SIZE
+static uint32_t WorkTail;   // Items queued
+static uint32_t WorkLost;   // Items dropped because the queue was full
+
+/*******************************Private Functions***********************************/
+
+// DeferredWorker
+// Runs queued work items in the order they were queued.
+static void DeferredWorker(void) {
+    while (1) {
+        G8RTOS_NotifyTake(true);
+        while (1) {
+            int32_t i_bit = StartCriticalSection();
+            if (WorkHead == WorkTail) {
+                EndCriticalSection(i_bit);
+                break;
+            }
+            deferredWork_t work = WorkQueue[WorkHead & (DEFERRED_QUEUE_SIZE - 1)];
+            WorkHead++;
+            EndCriticalSection(i_bit);
+            work.function(work.argument);
+        }
+    }
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_DeferFromISR
+// Queues a function to run in the deferred work thread, so an interrupt
+// handler can leave its slow work to a thread. Call G8RTOS_ExitISR at the
+// end of the handler to switch to the worker if it outranks the interrupted
+// thread. Also callable from threads, which are preempted at once when the
+// worker outranks them.
+// Param "function": run by the worker with "argument"
+// Param "argument": passed to the function
+// Return: bool, false if the queue was full and the item was dropped
+bool G8RTOS_DeferFromISR(void (*function)(void*), void* argument) {
+    int32_t i_bit = StartCriticalSection();
+    if (WorkTail - WorkHead == DEFERRED_QUEUE_SIZE) {
+        WorkLost++;
+        EndCriticalSection(i_bit);
+        return false;
+    }
+    deferredWork_t* work = &WorkQueue[WorkTail & (DEFERRED_QUEUE_SIZE - 1)];
+    work->function = function;
+    work->argument = argument;
+    WorkTail++;
+    if (InHandlerMode()) G8RTOS_NotifyGiveFromISR(DEFERRED_THREAD_ID);
+    else G8RTOS_NotifyGive(DEFERRED_THREAD_ID);
+    EndCriticalSection(i_bit);
+    return true;
+}
+
+// G8RTOS_GetDeferredLost
+// Gets the number of work items dropped because the queue was full.
+// Return: uint32_t
+uint32_t G8RTOS_GetDeferredLost(void) {
+    return WorkLost;
+}
+
+// InitDeferredWork
+// Empties the work queue and adds the deferred work thread.
+// Called by G8RTOS_Init when DEFERRED_WORK is set.
+// Return: void
+void InitDeferredWork(void) {
+    WorkHead = NULL;
+    WorkTail = NULL;
+    WorkLost = NULL;
+    G8RTOS_AddThread(DeferredWorker, DEFERRED_PRIORITY, "deferred", DEFERRED_THREAD_ID, DEFERRED_STACKSIZE);
+    return;
+}
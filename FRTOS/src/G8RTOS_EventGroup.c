@@ -0,0 +1,172 @@
+// G8RTOS_EventGroup.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for event flag group functions
+
+#include "../G8RTOS_EventGroup.h"
+
+/************************************Includes***************************************/
+
+#include <stdbool.h>
+
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Scheduler.h"
+
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+
+/*******************************Private Functions***********************************/
+
+// Satisfied
+// Checks whether a set of flags satisfies a wait.
+// Param uint32_t "flags": current flags of the group
+// Param uint32_t "mask": bits waited for
+// Param uint8_t "options": EVENT_WAIT_ANY or EVENT_WAIT_ALL, plus EVENT_CLEAR_ON_EXIT
+// Return: bool
+static bool Satisfied(uint32_t flags, uint32_t mask, uint8_t options) {
+    if (options & EVENT_WAIT_ALL) return (flags & mask) == mask;
+    return (flags & mask) != NULL;
+}
+
+// SetBits
+// Sets bits in the group and wakes every waiter whose wait is now satisfied.
+// Bits to clear on exit are cleared after all waiters have been checked, so
+// every waiter woken by the same call sees them. Call inside a critical section.
+// Param G8RTOS_EventGroup_t* "e": Pointer to event group
+// Param uint32_t "bits": bits to set
+// Param bool* "preempt": set if a woken thread outranks the running one
+// Return: uint32_t, the flags after waking the waiters
+static uint32_t SetBits(G8RTOS_EventGroup_t* e, uint32_t bits, bool* preempt) {
+    uint32_t flags = e->flags | bits;
+    uint32_t clear = NULL;
+    tcb_t* iter = e->waitQueue;
+    while (iter) {
+        tcb_t* next = iter->nextWaitTCB;
+        if (Satisfied(flags, iter->eventBits, iter->eventOptions)) {
+            if (iter->eventOptions & EVENT_CLEAR_ON_EXIT) clear |= iter->eventBits;
+            iter->eventBits = flags;
+            RemoveFromWaitQueue(iter);
+            AddToReadyList(iter);
+            if (iter->priority < CurrentlyRunningThread->priority) *preempt = true;
+        }
+        iter = next;
+    }
+    e->flags = flags & ~clear;
+    return e->flags;
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_InitEventGroup
+// Initializes an event group with every flag clear.
+// Param "e": Pointer to event group
+// Return: void
+void G8RTOS_InitEventGroup(G8RTOS_EventGroup_t* e) {
+    int32_t i_bit = StartCriticalSection();
+    e->flags = NULL;
+    e->waitQueue = NULL;
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_WaitEvents
+// Blocks until any (EVENT_WAIT_ANY) or all (EVENT_WAIT_ALL) of the bits in
+// "mask" are set. With EVENT_CLEAR_ON_EXIT, those bits are cleared once the
+// wait is satisfied. Must not be called from an ISR.
+// Param "e": Pointer to event group
+// Param "mask": bits to wait for, not 0
+// Param "options": EVENT_WAIT_ANY or EVENT_WAIT_ALL, optionally | EVENT_CLEAR_ON_EXIT
+// Return: uint32_t, the flags that satisfied the wait, before any clearing
+uint32_t G8RTOS_WaitEvents(G8RTOS_EventGroup_t* e, uint32_t mask, uint8_t options) {
+    uint32_t flags;
+    G8RTOS_WaitEventsTimeout(e, mask, options, WAIT_FOREVER, &flags);
+    return flags;
+}
+
+// G8RTOS_WaitEventsTimeout
+// G8RTOS_WaitEvents that gives up after "timeout" systicks.
+// Param "e": Pointer to event group
+// Param "mask": bits to wait for, not 0
+// Param "options": EVENT_WAIT_ANY or EVENT_WAIT_ALL, optionally | EVENT_CLEAR_ON_EXIT
+// Param "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Param "flags": set to the flags that satisfied the wait, or the current flags on a timeout
+// Return: sched_ErrCode_t, WAIT_TIMEOUT if the wait timed out
+sched_ErrCode_t G8RTOS_WaitEventsTimeout(G8RTOS_EventGroup_t* e, uint32_t mask, uint8_t options, uint32_t timeout, uint32_t* flags) {
+    int32_t i_bit = StartCriticalSection();
+    *flags = e->flags;
+    if (Satisfied(*flags, mask, options)) {
+        if (options & EVENT_CLEAR_ON_EXIT) e->flags &= ~mask;
+        EndCriticalSection(i_bit);
+        return NO_ERROR;
+    }
+    if (!timeout) {
+        EndCriticalSection(i_bit);
+        return WAIT_TIMEOUT;
+    }
+    CurrentlyRunningThread->eventBits = mask;
+    CurrentlyRunningThread->eventOptions = options;
+    RemoveFromReadyList(CurrentlyRunningThread);
+    AddToWaitQueue(&e->waitQueue, CurrentlyRunningThread);
+    StartTimeout(CurrentlyRunningThread, timeout);
+    EndCriticalSection(i_bit);
+    HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    SWITCH_BARRIER();
+    if (CurrentlyRunningThread->timedOut) {
+        *flags = e->flags;
+        return WAIT_TIMEOUT;
+    }
+    /* G8RTOS_SetEvents leaves the flags that woke this thread in eventBits. */
+    *flags = CurrentlyRunningThread->eventBits;
+    return NO_ERROR;
+}
+
+// G8RTOS_SetEvents
+// Sets bits in the group and wakes every waiter whose wait is now satisfied,
+// switching to them if one outranks the caller.
+// Param "e": Pointer to event group
+// Param "bits": bits to set
+// Return: uint32_t, the flags after waking the waiters
+uint32_t G8RTOS_SetEvents(G8RTOS_EventGroup_t* e, uint32_t bits) {
+    int32_t i_bit = StartCriticalSection();
+    bool preempt = false;
+    uint32_t flags = SetBits(e, bits, &preempt);
+    EndCriticalSection(i_bit);
+    /* Run a woken thread right away if it is more important than this one. */
+    if (preempt) HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    return flags;
+}
+
+// G8RTOS_SetEventsFromISR
+// G8RTOS_SetEvents for interrupt handlers, see G8RTOS_ExitISR.
+// Param "e": Pointer to event group
+// Param "bits": bits to set
+// Return: uint32_t, the flags after waking the waiters
+uint32_t G8RTOS_SetEventsFromISR(G8RTOS_EventGroup_t* e, uint32_t bits) {
+    int32_t i_bit = StartCriticalSection();
+    bool preempt = false;
+    uint32_t flags = SetBits(e, bits, &preempt);
+    if (preempt) RequestSwitchFromISR();
+    EndCriticalSection(i_bit);
+    return flags;
+}
+
+// G8RTOS_ClearEvents
+// Clears bits in the group. Safe to call from ISRs.
+// Param "e": Pointer to event group
+// Param "bits": bits to clear
+// Return: uint32_t, the flags before clearing
+uint32_t G8RTOS_ClearEvents(G8RTOS_EventGroup_t* e, uint32_t bits) {
+    int32_t i_bit = StartCriticalSection();
+    uint32_t flags = e->flags;
+    e->flags = flags & ~bits;
+    EndCriticalSection(i_bit);
+    return flags;
+}
+
+// G8RTOS_GetEvents
+// Gets the current flags of the group. Safe to call from ISRs.
+// Param "e": Pointer to event group
+// Return: uint32_t
+uint32_t G8RTOS_GetEvents(G8RTOS_EventGroup_t* e) {
+    return e->flags;
+}
@@ -1,6 +1,6 @@
 // G8RTOS_IPC.c
 // Date Created: 2023-07-25
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // Defines for FIFO functions for interprocess communication
 
 #include "../G8RTOS_IPC.h"
@@ -8,19 +8,26 @@
 /************************************Includes***************************************/
 
 #include "../G8RTOS_Semaphores.h"
+#include "../G8RTOS_Scheduler.h"
+#include "../G8RTOS_Trace.h"
 
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
 
+// currentSize and roomLeft count the words and free slots. Readers only
+// write head and writers only write tail, so readers and writers have
+// separate mutexes and a blocked bulk writer never holds up the readers.
 typedef struct G8RTOS_FIFO_t {
-    int32_t buffer[FIFO_SIZE];
-    int32_t *head;
-    int32_t *tail;
+    int32_t *buffer;
+    uint32_t size;
+    uint32_t head;
+    uint32_t tail;
     uint32_t lostData;
     semaphore_t currentSize;
     semaphore_t roomLeft;
-    semaphore_t mutex;
+    semaphore_t readMutex;
+    semaphore_t writeMutex;
 } G8RTOS_FIFO_t;
 
 
@@ -30,65 +37,301 @@ typedef struct G8RTOS_FIFO_t {
 
 static G8RTOS_FIFO_t FIFOs[MAX_NUMBER_OF_FIFOS];
 
+// Default storage for FIFOs set up with G8RTOS_InitFIFO
+static int32_t FIFOBuffers[MAX_NUMBER_OF_FIFOS][FIFO_SIZE];
+
+/*******************************Private Functions***********************************/
+
+// FIFOAdvance
+// Returns a head or tail index moved on by one slot, wrapping at size.
+// Param G8RTOS_FIFO_t* "fifo": FIFO the index belongs to
+// Param uint32_t "index": head or tail index
+// Return: uint32_t
+static inline uint32_t FIFOAdvance(G8RTOS_FIFO_t* fifo, uint32_t index) {
+    return (++index == fifo->size) ? NULL : index;
+}
+
+// FIFOPop
+// Removes the word at the head. The caller has already waited on currentSize.
+// Param G8RTOS_FIFO_t* "fifo": FIFO to read
+// Return: int32_t
+static inline int32_t FIFOPop(G8RTOS_FIFO_t* fifo) {
+    int32_t data = fifo->buffer[fifo->head];
+    fifo->head = FIFOAdvance(fifo, fifo->head);
+    return data;
+}
+
+// FIFOPush
+// Appends a word at the tail, publishing it with the final store to tail.
+// The caller has already made sure there is room.
+// Param G8RTOS_FIFO_t* "fifo": FIFO to write
+// Param int32_t "data": data to be written
+// Return: void
+static inline void FIFOPush(G8RTOS_FIFO_t* fifo, int32_t data) {
+    fifo->buffer[fifo->tail] = data;
+    fifo->tail = FIFOAdvance(fifo, fifo->tail);
+    return;
+}
+
+// TimeLeft
+// Part of a timeout not yet used up by an earlier wait of the same call.
+// Param uint32_t "timeout": systicks the whole call may wait, or WAIT_FOREVER
+// Param uint32_t "start": SystemTime when the call started
+// Return: uint32_t, 0 once the timeout has passed
+static inline uint32_t TimeLeft(uint32_t timeout, uint32_t start) {
+    uint32_t elapsed = SystemTime - start;
+    if (timeout == WAIT_FOREVER) return WAIT_FOREVER;
+    return (elapsed < timeout) ? timeout - elapsed : NULL;
+}
+
 /********************************Public Functions***********************************/
 
 // Three semaphore implementation
 
 // G8RTOS_InitFIFO
-// Initializes FIFO, points head & tail to relevant buffer
-// memory addresses. Returns - 1 if FIFO full, 0 if no error
+// Initializes FIFO with its default FIFO_SIZE buffer.
 // Param uint32_t "FIFO_index": Index of FIFO block
 // Return: int32_t
 int32_t G8RTOS_InitFIFO(uint32_t FIFO_index) {
     if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
-    // Initialize head, tail pointers
-    FIFOs[FIFO_index].head = &FIFOs[FIFO_index].buffer[NULL];
-    FIFOs[FIFO_index].tail = &FIFOs[FIFO_index].buffer[NULL];
-    /* Clear all the data, if any */
-    for (uint32_t i = NULL; i < FIFO_SIZE; i++) FIFOs[FIFO_index].buffer[i] = NULL;
-    // Init the mutex, current size
-    FIFOs[FIFO_index].currentSize = NULL;
-    FIFOs[FIFO_index].roomLeft = FIFO_SIZE;
-    G8RTOS_InitSemaphore(&FIFOs[FIFO_index].mutex, 1);
+    return G8RTOS_InitFIFOBuffer(FIFO_index, FIFOBuffers[FIFO_index], FIFO_SIZE);
+}
+
+// G8RTOS_InitFIFOBuffer
+// Initializes FIFO over caller-provided static storage, so each FIFO can
+// have its own size. Returns -1 if out of bounds, 0 if no error
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t* "buffer": storage for "size" words
+// Param uint32_t "size": capacity of the FIFO in words
+// Return: int32_t
+int32_t G8RTOS_InitFIFOBuffer(uint32_t FIFO_index, int32_t* buffer, uint32_t size) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS || !size) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    fifo->buffer = buffer;
+    fifo->size = size;
+    fifo->head = NULL;
+    fifo->tail = NULL;
+    // Init the mutexes, current size, room left
+    G8RTOS_InitSemaphore(&fifo->currentSize, NULL);
+    G8RTOS_InitSemaphore(&fifo->roomLeft, size);
+    G8RTOS_InitSemaphore(&fifo->readMutex, 1);
+    G8RTOS_InitSemaphore(&fifo->writeMutex, 1);
     // Init lost data
-    FIFOs[FIFO_index].lostData = NULL;
+    fifo->lostData = NULL;
     return SUCCESS;
 }
 
 // G8RTOS_ReadFIFO
-// Reads data from head pointer of FIFO.
+// Reads data from head of FIFO, blocking while the FIFO is empty.
 // Param uint32_t "FIFO_index": Index of FIFO block
 // Return: int32_t
 int32_t G8RTOS_ReadFIFO(uint32_t FIFO_index) {
-    if (FIFO_index >= FIFO_SIZE) return INDEX_OUT_OF_BOUNDS;
-    if (!FIFOs[FIFO_index].currentSize) return FIFO_EMPTY;
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
     /* Read in first in first out fashion. */
-    int32_t data = *(FIFOs[FIFO_index].head);
-    (FIFOs[FIFO_index].currentSize)--;
-    (FIFOs[FIFO_index].roomLeft)++;
-    (FIFOs[FIFO_index].head)++;
-    if (FIFOs[FIFO_index].head == &FIFOs[FIFO_index].buffer[FIFO_SIZE]) FIFOs[FIFO_index].head = &FIFOs[FIFO_index].buffer[NULL];
-    //else (FIFOs[FIFO_index].head)++;
+    G8RTOS_WaitSemaphore(&fifo->currentSize);
+    G8RTOS_WaitSemaphore(&fifo->readMutex);
+    int32_t data = FIFOPop(fifo);
+    G8RTOS_SignalSemaphore(&fifo->readMutex);
+    G8RTOS_SignalSemaphore(&fifo->roomLeft);
+    TRACE(TRACE_FIFO_READ, FIFO_index);
     return data;
 }
 
 // G8RTOS_WriteFIFO
-// Writes data to tail of buffer.
-// 0 if no error, -1 if out of bounds, -2 if full
+// Writes data to tail of buffer, blocking while the FIFO is full.
+// 0 if no error, -1 if out of bounds
 // Param uint32_t "FIFO_index": Index of FIFO block
 // Param int32_t "data": data to be written
 // Return: int32_t
 int32_t G8RTOS_WriteFIFO(uint32_t FIFO_index, int32_t data) {
-    // Your code
-    if (FIFO_index >= FIFO_SIZE) return INDEX_OUT_OF_BOUNDS;
-    if (!FIFOs[FIFO_index].roomLeft) return FIFO_FULL;
-    /* Before we write, we check if there's any data already there. */
-    if (*FIFOs[FIFO_index].tail) FIFOs[FIFO_index].lostData++;
-    *(FIFOs[FIFO_index].tail) = data;
-    (FIFOs[FIFO_index].currentSize)++;
-    (FIFOs[FIFO_index].roomLeft)--;
-    (FIFOs[FIFO_index].tail)++;
-    if (FIFOs[FIFO_index].tail == &FIFOs[FIFO_index].buffer[FIFO_SIZE]) FIFOs[FIFO_index].tail = &FIFOs[FIFO_index].buffer[NULL];
-    //else (FIFOs[FIFO_index].tail)++;
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    G8RTOS_WaitSemaphore(&fifo->roomLeft);
+    G8RTOS_WaitSemaphore(&fifo->writeMutex);
+    FIFOPush(fifo, data);
+    G8RTOS_SignalSemaphore(&fifo->writeMutex);
+    G8RTOS_SignalSemaphore(&fifo->currentSize);
+    TRACE(TRACE_FIFO_WRITE, FIFO_index);
+    return SUCCESS;
+}
+
+// G8RTOS_ReadFIFOBulk
+// Reads "count" words into "data", blocking until all of them have arrived.
+// The read mutex is held for the whole transfer, so the words are not
+// interleaved with other readers.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t* "data": destination for the words
+// Param uint32_t "count": number of words to read
+// Return: int32_t
+int32_t G8RTOS_ReadFIFOBulk(uint32_t FIFO_index, int32_t* data, uint32_t count) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    G8RTOS_WaitSemaphore(&fifo->readMutex);
+    for (uint32_t i = NULL; i < count; i++) {
+        G8RTOS_WaitSemaphore(&fifo->currentSize);
+        data[i] = FIFOPop(fifo);
+        G8RTOS_SignalSemaphore(&fifo->roomLeft);
+    }
+    G8RTOS_SignalSemaphore(&fifo->readMutex);
+    TRACE(TRACE_FIFO_READ, FIFO_index);
+    return SUCCESS;
+}
+
+// G8RTOS_WriteFIFOBulk
+// Writes "count" words from "data", blocking while the FIFO is full.
+// The write mutex is held for the whole transfer, so the words are not
+// interleaved with other writers.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t* "data": words to write
+// Param uint32_t "count": number of words to write
+// Return: int32_t
+int32_t G8RTOS_WriteFIFOBulk(uint32_t FIFO_index, const int32_t* data, uint32_t count) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    G8RTOS_WaitSemaphore(&fifo->writeMutex);
+    for (uint32_t i = NULL; i < count; i++) {
+        G8RTOS_WaitSemaphore(&fifo->roomLeft);
+        FIFOPush(fifo, data[i]);
+        G8RTOS_SignalSemaphore(&fifo->currentSize);
+    }
+    G8RTOS_SignalSemaphore(&fifo->writeMutex);
+    TRACE(TRACE_FIFO_WRITE, FIFO_index);
+    return SUCCESS;
+}
+
+// G8RTOS_ReadFIFOTimeout
+// G8RTOS_ReadFIFO that gives up after "timeout" systicks.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t* "data": set to the word read
+// Param uint32_t "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Return: int32_t, WAIT_TIMEOUT if nothing was read in time
+int32_t G8RTOS_ReadFIFOTimeout(uint32_t FIFO_index, int32_t* data, uint32_t timeout) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    uint32_t start = SystemTime;
+    if (G8RTOS_WaitSemaphoreTimeout(&fifo->currentSize, timeout) != NO_ERROR) return WAIT_TIMEOUT;
+    if (G8RTOS_WaitSemaphoreTimeout(&fifo->readMutex, TimeLeft(timeout, start)) != NO_ERROR) {
+        /* Leave the word for the reader holding the mutex. */
+        G8RTOS_SignalSemaphore(&fifo->currentSize);
+        return WAIT_TIMEOUT;
+    }
+    *data = FIFOPop(fifo);
+    G8RTOS_SignalSemaphore(&fifo->readMutex);
+    G8RTOS_SignalSemaphore(&fifo->roomLeft);
+    TRACE(TRACE_FIFO_READ, FIFO_index);
+    return SUCCESS;
+}
+
+// G8RTOS_WriteFIFOTimeout
+// G8RTOS_WriteFIFO that gives up after "timeout" systicks.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t "data": data to be written
+// Param uint32_t "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Return: int32_t, WAIT_TIMEOUT if nothing was written in time
+int32_t G8RTOS_WriteFIFOTimeout(uint32_t FIFO_index, int32_t data, uint32_t timeout) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    uint32_t start = SystemTime;
+    if (G8RTOS_WaitSemaphoreTimeout(&fifo->roomLeft, timeout) != NO_ERROR) return WAIT_TIMEOUT;
+    if (G8RTOS_WaitSemaphoreTimeout(&fifo->writeMutex, TimeLeft(timeout, start)) != NO_ERROR) {
+        G8RTOS_SignalSemaphore(&fifo->roomLeft);
+        return WAIT_TIMEOUT;
+    }
+    FIFOPush(fifo, data);
+    G8RTOS_SignalSemaphore(&fifo->writeMutex);
+    G8RTOS_SignalSemaphore(&fifo->currentSize);
+    TRACE(TRACE_FIFO_WRITE, FIFO_index);
+    return SUCCESS;
+}
+
+// G8RTOS_ReadFIFOBulkTimeout
+// G8RTOS_ReadFIFOBulk that gives up after "timeout" systicks in total,
+// keeping the words that arrived before then.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t* "data": destination for the words
+// Param uint32_t "count": number of words to read
+// Param uint32_t "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Param uint32_t* "transferred": set to the number of words read
+// Return: int32_t, WAIT_TIMEOUT if fewer than "count" words were read
+int32_t G8RTOS_ReadFIFOBulkTimeout(uint32_t FIFO_index, int32_t* data, uint32_t count, uint32_t timeout, uint32_t* transferred) {
+    *transferred = NULL;
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    uint32_t start = SystemTime;
+    if (G8RTOS_WaitSemaphoreTimeout(&fifo->readMutex, timeout) != NO_ERROR) return WAIT_TIMEOUT;
+    uint32_t i;
+    for (i = NULL; i < count; i++) {
+        if (G8RTOS_WaitSemaphoreTimeout(&fifo->currentSize, TimeLeft(timeout, start)) != NO_ERROR) break;
+        data[i] = FIFOPop(fifo);
+        G8RTOS_SignalSemaphore(&fifo->roomLeft);
+    }
+    G8RTOS_SignalSemaphore(&fifo->readMutex);
+    *transferred = i;
+    if (i) {
+        TRACE(TRACE_FIFO_READ, FIFO_index);
+    }
+    return (i == count) ? SUCCESS : WAIT_TIMEOUT;
+}
+
+// G8RTOS_WriteFIFOBulkTimeout
+// G8RTOS_WriteFIFOBulk that gives up after "timeout" systicks in total,
+// keeping the words that were written before then.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t* "data": words to write
+// Param uint32_t "count": number of words to write
+// Param uint32_t "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Param uint32_t* "transferred": set to the number of words written
+// Return: int32_t, WAIT_TIMEOUT if fewer than "count" words were written
+int32_t G8RTOS_WriteFIFOBulkTimeout(uint32_t FIFO_index, const int32_t* data, uint32_t count, uint32_t timeout, uint32_t* transferred) {
+    *transferred = NULL;
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    uint32_t start = SystemTime;
+    if (G8RTOS_WaitSemaphoreTimeout(&fifo->writeMutex, timeout) != NO_ERROR) return WAIT_TIMEOUT;
+    uint32_t i;
+    for (i = NULL; i < count; i++) {
+        if (G8RTOS_WaitSemaphoreTimeout(&fifo->roomLeft, TimeLeft(timeout, start)) != NO_ERROR) break;
+        FIFOPush(fifo, data[i]);
+        G8RTOS_SignalSemaphore(&fifo->currentSize);
+    }
+    G8RTOS_SignalSemaphore(&fifo->writeMutex);
+    *transferred = i;
+    if (i) {
+        TRACE(TRACE_FIFO_WRITE, FIFO_index);
+    }
+    return (i == count) ? SUCCESS : WAIT_TIMEOUT;
+}
+
+// G8RTOS_WriteFIFOFromISR
+// Single-producer write path for interrupt handlers. Never blocks and does not
+// take the write mutex: a slot is claimed from roomLeft without waiting, the word is
+// stored and published by the store to tail, then currentSize is signalled
+// to wake a parked reader, leaving any switch to G8RTOS_ExitISR. Drops the
+// word and counts it in lostData if the FIFO is full. The ISR must be the
+// only writer of this FIFO.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Param int32_t "data": data to be written
+// Return: int32_t
+int32_t G8RTOS_WriteFIFOFromISR(uint32_t FIFO_index, int32_t data) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_FIFO_t* fifo = &FIFOs[FIFO_index];
+    if (!G8RTOS_TryWaitSemaphore(&fifo->roomLeft)) {
+        fifo->lostData++;
+        TRACE(TRACE_FIFO_LOST, FIFO_index);
+        return FIFO_FULL;
+    }
+    FIFOPush(fifo, data);
+    G8RTOS_SignalSemaphoreFromISR(&fifo->currentSize);
+    TRACE(TRACE_FIFO_WRITE, FIFO_index);
     return SUCCESS;
 }
+
+// G8RTOS_GetFIFOLostData
+// Gets the number of words dropped by G8RTOS_WriteFIFOFromISR.
+// Param uint32_t "FIFO_index": Index of FIFO block
+// Return: uint32_t
+uint32_t G8RTOS_GetFIFOLostData(uint32_t FIFO_index) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) return NULL;
+    return FIFOs[FIFO_index].lostData;
+}
@@ -0,0 +1,241 @@
+// G8RTOS_Mailbox.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for zero-copy mailbox functions for interprocess communication
+
+#include "../G8RTOS_Mailbox.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Scheduler.h"
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Header in front of every message buffer in the mailbox region. While the
+// buffer is free, "next" links the free list; once posted, it links the
+// mailbox's message queue.
+typedef struct mailboxMessage_t {
+    struct mailboxMessage_t *next;
+    uint32_t size;      // Words in the block, including this header
+    uint32_t length;    // Payload length in bytes
+    uint32_t mailbox;   // Mailbox the buffer was reserved for
+} mailboxMessage_t;
+
+typedef struct G8RTOS_Mailbox_t {
+    mailboxMessage_t *head;
+    mailboxMessage_t *tail;
+    semaphore_t messages;
+    uint32_t wordsInUse;
+    uint32_t highWater;
+} G8RTOS_Mailbox_t;
+
+/***********************************Externs*****************************************/
+
+/********************************Private Variables***********************************/
+
+static G8RTOS_Mailbox_t Mailboxes[MAX_NUMBER_OF_MAILBOXES];
+
+// Kernel-owned region message buffers are carved from
+static uint32_t MailboxRegion[MAILBOX_REGION_SIZE];
+
+// Free blocks below RegionBreak, sorted by address
+static mailboxMessage_t* FreeList;
+
+// Words at the start of the region that have ever been handed out
+static uint32_t RegionBreak;
+
+static uint32_t RegionInUse;
+static uint32_t RegionHighWater;
+
+/*******************************Private Functions***********************************/
+
+// RegionAlloc
+// First-fit allocation from the free list, falling back to untouched space
+// above RegionBreak. Splits a larger free block and keeps the remainder.
+// Call inside a critical section.
+// Param uint32_t "words": block size including the header
+// Return: mailboxMessage_t*, NULL if the region has no room
+static mailboxMessage_t* RegionAlloc(uint32_t words) {
+    mailboxMessage_t** link = &FreeList;
+    while (*link && (*link)->size < words) link = &(*link)->next;
+    mailboxMessage_t* block = *link;
+    if (block) {
+        if (block->size - words > sizeof(mailboxMessage_t) / sizeof(uint32_t)) {
+            mailboxMessage_t* rest = (mailboxMessage_t*)((uint32_t*)block + words);
+            rest->size = block->size - words;
+            rest->next = block->next;
+            *link = rest;
+            block->size = words;
+        } else {
+            *link = block->next;
+        }
+    } else {
+        if (words > MAILBOX_REGION_SIZE - RegionBreak) return NULL;
+        block = (mailboxMessage_t*)&MailboxRegion[RegionBreak];
+        block->size = words;
+        RegionBreak += words;
+    }
+    RegionInUse += block->size;
+    if (RegionInUse > RegionHighWater) RegionHighWater = RegionInUse;
+    return block;
+}
+
+// RegionFree
+// Returns a block to the address-sorted free list, merging it with free
+// neighbours, and gives space back to the break when it is at the top.
+// Call inside a critical section.
+// Param mailboxMessage_t* "block": block to free
+// Return: void
+static void RegionFree(mailboxMessage_t* block) {
+    RegionInUse -= block->size;
+    // Find the link the block belongs at, remembering the one before it
+    mailboxMessage_t** link = &FreeList;
+    mailboxMessage_t** previousLink = NULL;
+    while (*link && *link < block) {
+        previousLink = link;
+        link = &(*link)->next;
+    }
+    block->next = *link;
+    *link = block;
+    // Merge with the following free block
+    if (block->next && (uint32_t*)block + block->size == (uint32_t*)block->next) {
+        block->size += block->next->size;
+        block->next = block->next->next;
+    }
+    // Merge into the preceding free block
+    if (previousLink && (uint32_t*)*previousLink + (*previousLink)->size == (uint32_t*)block) {
+        (*previousLink)->size += block->size;
+        (*previousLink)->next = block->next;
+        link = previousLink;
+        block = *link;
+    }
+    /* The last free block sits right under the break, hand it back. */
+    if (!block->next && (uint32_t*)block + block->size == &MailboxRegion[RegionBreak]) {
+        RegionBreak -= block->size;
+        *link = NULL;
+    }
+    return;
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_InitMailbox
+// Initializes an empty mailbox.
+// Param uint32_t "mailbox_index": Index of mailbox
+// Return: int32_t
+int32_t G8RTOS_InitMailbox(uint32_t mailbox_index) {
+    if (mailbox_index >= MAX_NUMBER_OF_MAILBOXES) return INDEX_OUT_OF_BOUNDS;
+    int32_t i_bit = StartCriticalSection();
+    Mailboxes[mailbox_index].head = NULL;
+    Mailboxes[mailbox_index].tail = NULL;
+    Mailboxes[mailbox_index].wordsInUse = NULL;
+    Mailboxes[mailbox_index].highWater = NULL;
+    EndCriticalSection(i_bit);
+    G8RTOS_InitSemaphore(&Mailboxes[mailbox_index].messages, NULL);
+    return SUCCESS;
+}
+
+// G8RTOS_ReserveMessage
+// Reserves a buffer of "length" bytes in the mailbox region for a message to
+// the given mailbox. The producer fills it in place, then posts it.
+// Param uint32_t "mailbox_index": Index of mailbox the message is for
+// Param uint32_t "length": payload length in bytes
+// Return: void*, the word-aligned payload, NULL if the region is full
+void* G8RTOS_ReserveMessage(uint32_t mailbox_index, uint32_t length) {
+    if (mailbox_index >= MAX_NUMBER_OF_MAILBOXES) return NULL;
+    uint32_t words = (sizeof(mailboxMessage_t) + length + 3) / sizeof(uint32_t);
+    int32_t i_bit = StartCriticalSection();
+    mailboxMessage_t* message = RegionAlloc(words);
+    if (message) {
+        message->next = NULL;
+        message->length = length;
+        message->mailbox = mailbox_index;
+        G8RTOS_Mailbox_t* mailbox = &Mailboxes[mailbox_index];
+        mailbox->wordsInUse += message->size;
+        if (mailbox->wordsInUse > mailbox->highWater) mailbox->highWater = mailbox->wordsInUse;
+    }
+    EndCriticalSection(i_bit);
+    return message ? (void*)(message + 1) : NULL;
+}
+
+// G8RTOS_PostMessage
+// Appends a reserved message to its mailbox and wakes a receiver.
+// Only the handle is queued, the payload is never copied.
+// Param void* "message": payload returned by G8RTOS_ReserveMessage
+// Return: int32_t
+int32_t G8RTOS_PostMessage(void* message) {
+    mailboxMessage_t* header = (mailboxMessage_t*)message - 1;
+    G8RTOS_Mailbox_t* mailbox = &Mailboxes[header->mailbox];
+    int32_t i_bit = StartCriticalSection();
+    if (mailbox->tail) mailbox->tail->next = header;
+    else mailbox->head = header;
+    mailbox->tail = header;
+    EndCriticalSection(i_bit);
+    G8RTOS_SignalSemaphore(&mailbox->messages);
+    return SUCCESS;
+}
+
+// G8RTOS_ReceiveMessage
+// Takes the oldest message from a mailbox, blocking while it is empty.
+// The consumer owns the buffer until it calls G8RTOS_ReleaseMessage.
+// Param uint32_t "mailbox_index": Index of mailbox
+// Param uint32_t* "length": set to the payload length in bytes, may be NULL
+// Return: void*, the payload
+void* G8RTOS_ReceiveMessage(uint32_t mailbox_index, uint32_t* length) {
+    void* message = NULL;
+    G8RTOS_ReceiveMessageTimeout(mailbox_index, &message, length, WAIT_FOREVER);
+    return message;
+}
+
+// G8RTOS_ReceiveMessageTimeout
+// G8RTOS_ReceiveMessage that gives up after "timeout" systicks.
+// Param uint32_t "mailbox_index": Index of mailbox
+// Param void** "message": set to the payload
+// Param uint32_t* "length": set to the payload length in bytes, may be NULL
+// Param uint32_t "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Return: int32_t, WAIT_TIMEOUT if no message arrived in time
+int32_t G8RTOS_ReceiveMessageTimeout(uint32_t mailbox_index, void** message, uint32_t* length, uint32_t timeout) {
+    if (mailbox_index >= MAX_NUMBER_OF_MAILBOXES) return INDEX_OUT_OF_BOUNDS;
+    G8RTOS_Mailbox_t* mailbox = &Mailboxes[mailbox_index];
+    if (G8RTOS_WaitSemaphoreTimeout(&mailbox->messages, timeout) != NO_ERROR) return WAIT_TIMEOUT;
+    int32_t i_bit = StartCriticalSection();
+    mailboxMessage_t* header = mailbox->head;
+    mailbox->head = header->next;
+    if (!mailbox->head) mailbox->tail = NULL;
+    EndCriticalSection(i_bit);
+    if (length) *length = header->length;
+    *message = (void*)(header + 1);
+    return SUCCESS;
+}
+
+// G8RTOS_ReleaseMessage
+// Returns a received (or reserved but never posted) buffer to the region.
+// Param void* "message": payload to release
+// Return: void
+void G8RTOS_ReleaseMessage(void* message) {
+    mailboxMessage_t* header = (mailboxMessage_t*)message - 1;
+    int32_t i_bit = StartCriticalSection();
+    Mailboxes[header->mailbox].wordsInUse -= header->size;
+    RegionFree(header);
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_GetMailboxHighWater
+// Gets the peak number of bytes, headers included, reserved for a mailbox.
+// Param uint32_t "mailbox_index": Index of mailbox
+// Return: uint32_t
+uint32_t G8RTOS_GetMailboxHighWater(uint32_t mailbox_index) {
+    if (mailbox_index >= MAX_NUMBER_OF_MAILBOXES) return NULL;
+    return Mailboxes[mailbox_index].highWater * sizeof(uint32_t);
+}
+
+// G8RTOS_GetMailboxRegionHighWater
+// Gets the peak number of bytes in use in the whole mailbox region.
+// Return: uint32_t
+uint32_t G8RTOS_GetMailboxRegionHighWater(void) {
+    return RegionHighWater * sizeof(uint32_t);
+}
@@ -0,0 +1,131 @@
+// G8RTOS_MemPool.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for fixed-block memory pool functions
+
+#include "../G8RTOS_MemPool.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Scheduler.h"
+
+/*******************************Private Functions***********************************/
+
+// PopBlock
+// Takes the first block off the free list and updates the usage statistics.
+// The caller has already taken "available", so the list is not empty.
+// Param G8RTOS_MemPool_t* "pool": pool to allocate from
+// Return: void*
+static void* PopBlock(G8RTOS_MemPool_t* pool) {
+    int32_t i_bit = StartCriticalSection();
+    void* block = pool->freeList;
+    pool->freeList = *(void**)block;
+    pool->blocksInUse++;
+    if (pool->blocksInUse > pool->peakInUse) pool->peakInUse = pool->blocksInUse;
+    EndCriticalSection(i_bit);
+    return block;
+}
+
+// PushBlock
+// Links a block back onto the front of the free list.
+// Param G8RTOS_MemPool_t* "pool": pool to free to
+// Param void* "block": block to return
+// Return: void
+static void PushBlock(G8RTOS_MemPool_t* pool, void* block) {
+    int32_t i_bit = StartCriticalSection();
+    *(void**)block = pool->freeList;
+    pool->freeList = block;
+    pool->blocksInUse--;
+    EndCriticalSection(i_bit);
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_InitPool
+// Splits static storage into "numBlocks" fixed-size blocks and links them
+// into the free list. Declare the storage with G8RTOS_POOL_STORAGE.
+// Param "pool": Pointer to pool
+// Param "storage": word-aligned storage for the blocks
+// Param "blockSize": size of each block in bytes
+// Param "numBlocks": number of blocks
+// Return: void
+void G8RTOS_InitPool(G8RTOS_MemPool_t* pool, void* storage, uint32_t blockSize, uint32_t numBlocks) {
+    uint32_t words = POOL_BLOCK_WORDS(blockSize);
+    uint32_t* block = (uint32_t*)storage;
+    int32_t i_bit = StartCriticalSection();
+    pool->freeList = NULL;
+    /* Link from the last block down, so blocks are handed out in address order. */
+    for (uint32_t i = numBlocks; i > NULL; i--) {
+        void** link = (void**)&block[(i - 1) * words];
+        *link = pool->freeList;
+        pool->freeList = link;
+    }
+    pool->blockSize = words * sizeof(uint32_t);
+    pool->numBlocks = numBlocks;
+    pool->blocksInUse = NULL;
+    pool->peakInUse = NULL;
+    pool->failedAllocs = NULL;
+    EndCriticalSection(i_bit);
+    G8RTOS_InitSemaphore(&pool->available, numBlocks);
+    return;
+}
+
+// G8RTOS_PoolAlloc
+// Allocates a block in constant time without blocking. Safe to call from ISRs.
+// Param "pool": Pointer to pool
+// Return: void*, NULL (and counted in failedAllocs) if the pool is empty
+void* G8RTOS_PoolAlloc(G8RTOS_MemPool_t* pool) {
+    if (!G8RTOS_TryWaitSemaphore(&pool->available)) {
+        int32_t i_bit = StartCriticalSection();
+        pool->failedAllocs++;
+        EndCriticalSection(i_bit);
+        return NULL;
+    }
+    return PopBlock(pool);
+}
+
+// G8RTOS_PoolAllocBlocking
+// Allocates a block, blocking the thread until one is free. Threads only.
+// Param "pool": Pointer to pool
+// Return: void*
+void* G8RTOS_PoolAllocBlocking(G8RTOS_MemPool_t* pool) {
+    G8RTOS_WaitSemaphore(&pool->available);
+    return PopBlock(pool);
+}
+
+// G8RTOS_PoolAllocTimeout
+// G8RTOS_PoolAllocBlocking that gives up after "timeout" systicks. Threads only.
+// Param "pool": Pointer to pool
+// Param "block": set to the block
+// Param "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Return: int32_t, NO_ERROR, or WAIT_TIMEOUT if no block was freed in time
+int32_t G8RTOS_PoolAllocTimeout(G8RTOS_MemPool_t* pool, void** block, uint32_t timeout) {
+    if (G8RTOS_WaitSemaphoreTimeout(&pool->available, timeout) != NO_ERROR) return WAIT_TIMEOUT;
+    *block = PopBlock(pool);
+    return NO_ERROR;
+}
+
+// G8RTOS_PoolFree
+// Returns a block to the front of the free list in constant time and wakes
+// a thread waiting to allocate. Interrupt handlers use G8RTOS_PoolFreeFromISR.
+// Param "pool": Pointer to pool
+// Param "block": block from G8RTOS_PoolAlloc or G8RTOS_PoolAllocBlocking
+// Return: void
+void G8RTOS_PoolFree(G8RTOS_MemPool_t* pool, void* block) {
+    PushBlock(pool, block);
+    G8RTOS_SignalSemaphore(&pool->available);
+    return;
+}
+
+// G8RTOS_PoolFreeFromISR
+// G8RTOS_PoolFree for interrupt handlers. A woken thread is switched to when
+// the handler calls G8RTOS_ExitISR.
+// Param "pool": Pointer to pool
+// Param "block": block from G8RTOS_PoolAlloc or G8RTOS_PoolAllocBlocking
+// Return: void
+void G8RTOS_PoolFreeFromISR(G8RTOS_MemPool_t* pool, void* block) {
+    PushBlock(pool, block);
+    G8RTOS_SignalSemaphoreFromISR(&pool->available);
+    return;
+}
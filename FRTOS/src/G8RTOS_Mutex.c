@@ -0,0 +1,201 @@
+// G8RTOS_Mutex.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for priority-inheritance mutex functions
+
+#include "../G8RTOS_Mutex.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Scheduler.h"
+
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+
+/*******************************Private Functions***********************************/
+
+// HandOff
+// Gives a mutex to the highest priority thread waiting for it, or frees it.
+// Call inside a critical section.
+// Param G8RTOS_Mutex_t* "m": mutex released by its owner
+// Return: tcb_t*, the new owner or NULL
+static tcb_t* HandOff(G8RTOS_Mutex_t* m) {
+    tcb_t* next = m->waitQueue;
+    m->owner = next;
+    if (!next) {
+        m->lockCount = NULL;
+        return NULL;
+    }
+    RemoveFromWaitQueue(next);
+    next->blockedMutex = NULL;
+    m->lockCount = 1;
+    m->nextHeld = next->heldMutexes;
+    next->heldMutexes = m;
+    AddToReadyList(next);
+    /* The remaining waiters now boost the new owner. */
+    InheritPriority(next);
+    return next;
+}
+
+// UnlinkHeld
+// Removes a mutex from its owner's list of held mutexes.
+// Param tcb_t* "owner": thread holding the mutex
+// Param G8RTOS_Mutex_t* "m": mutex to remove
+// Return: void
+static void UnlinkHeld(tcb_t* owner, G8RTOS_Mutex_t* m) {
+    G8RTOS_Mutex_t** iter = &owner->heldMutexes;
+    /* Mutexes are usually released in reverse order, so this is normally the head. */
+    while (*iter != m) iter = &(*iter)->nextHeld;
+    *iter = m->nextHeld;
+    m->nextHeld = NULL;
+    return;
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_InitMutex
+// Initializes a mutex as unlocked.
+// Param "m": Pointer to mutex
+// Return: void
+void G8RTOS_InitMutex(G8RTOS_Mutex_t* m) {
+    int32_t i_bit = StartCriticalSection();
+    m->owner = NULL;
+    m->lockCount = NULL;
+    m->waitQueue = NULL;
+    m->nextHeld = NULL;
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_LockMutex
+// Locks the mutex, or increments the lock count if this thread already owns it.
+// Otherwise the thread blocks, and lends its priority to the owner and to
+// every owner further along the chain of mutexes they are waiting for.
+// Param "m": Pointer to mutex
+// Return: void
+void G8RTOS_LockMutex(G8RTOS_Mutex_t* m) {
+    G8RTOS_LockMutexTimeout(m, WAIT_FOREVER);
+    return;
+}
+
+// G8RTOS_LockMutexTimeout
+// G8RTOS_LockMutex that gives up after "timeout" systicks, taking back the
+// priority it lent the owner.
+// Param "m": Pointer to mutex
+// Param "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Return: sched_ErrCode_t, WAIT_TIMEOUT if the wait timed out
+sched_ErrCode_t G8RTOS_LockMutexTimeout(G8RTOS_Mutex_t* m, uint32_t timeout) {
+    int32_t i_bit = StartCriticalSection();
+    if (!m->owner) {
+        m->owner = CurrentlyRunningThread;
+        m->lockCount = 1;
+        m->nextHeld = CurrentlyRunningThread->heldMutexes;
+        CurrentlyRunningThread->heldMutexes = m;
+        EndCriticalSection(i_bit);
+        return NO_ERROR;
+    }
+    if (m->owner == CurrentlyRunningThread) {
+        (m->lockCount)++;
+        EndCriticalSection(i_bit);
+        return NO_ERROR;
+    }
+    if (!timeout) {
+        EndCriticalSection(i_bit);
+        return WAIT_TIMEOUT;
+    }
+    CurrentlyRunningThread->blockedMutex = m;
+    RemoveFromReadyList(CurrentlyRunningThread);
+    AddToWaitQueue(&m->waitQueue, CurrentlyRunningThread);
+    /* Transitive inheritance: walk the chain of owners until one is already fast enough. */
+    uint8_t priority = CurrentlyRunningThread->priority;
+    tcb_t* owner = m->owner;
+    while (owner && priority < owner->priority) {
+        SetThreadPriority(owner, priority);
+        if (!owner->blockedMutex) break;
+        owner = owner->blockedMutex->owner;
+    }
+    StartTimeout(CurrentlyRunningThread, timeout);
+    EndCriticalSection(i_bit);
+    /* Sleep until the owner hands the mutex over. */
+    HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    SWITCH_BARRIER();
+    return CurrentlyRunningThread->timedOut ? WAIT_TIMEOUT : NO_ERROR;
+}
+
+// G8RTOS_UnlockMutex
+// Decrements the lock count. When it reaches zero, the owner drops back to
+// the priority it is owed by its remaining mutexes and the mutex is handed
+// to its highest priority waiter, preempting the owner if that waiter is
+// more important. Does nothing if the calling thread is not the owner.
+// Param "m": Pointer to mutex
+// Return: void
+void G8RTOS_UnlockMutex(G8RTOS_Mutex_t* m) {
+    int32_t i_bit = StartCriticalSection();
+    if (m->owner != CurrentlyRunningThread || --(m->lockCount)) {
+        EndCriticalSection(i_bit);
+        return;
+    }
+    UnlinkHeld(CurrentlyRunningThread, m);
+    InheritPriority(CurrentlyRunningThread);
+    tcb_t* next = HandOff(m);
+    EndCriticalSection(i_bit);
+    if (next && next->priority < CurrentlyRunningThread->priority) {
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    }
+    return;
+}
+
+// InheritPriority
+// Sets a thread's effective priority to the higher of its base priority and
+// the highest priority thread waiting on a mutex it holds.
+// Call inside a critical section.
+// Param tcb_t* "thread": mutex owner to update
+// Return: void
+void InheritPriority(tcb_t* thread) {
+    uint8_t priority = thread->basePriority;
+    for (G8RTOS_Mutex_t* held = thread->heldMutexes; held; held = held->nextHeld) {
+        /* Wait queues are sorted, so the head is the highest priority waiter. */
+        if (held->waitQueue && held->waitQueue->priority < priority) priority = held->waitQueue->priority;
+    }
+    SetThreadPriority(thread, priority);
+    return;
+}
+
+// RemoveMutexWaiter
+// Takes a killed or timed-out thread out of the wait queue of its mutex and lowers the
+// inherited priority of every owner along the chain that was boosted by that thread.
+// Call inside a critical section.
+// Param tcb_t* "thread": thread waiting on a mutex
+// Return: void
+void RemoveMutexWaiter(tcb_t* thread) {
+    G8RTOS_Mutex_t* m = thread->blockedMutex;
+    RemoveFromWaitQueue(thread);
+    thread->blockedMutex = NULL;
+    /* Undo the walk in G8RTOS_LockMutexTimeout, stopping at the first owner whose priority holds. */
+    tcb_t* owner = m->owner;
+    while (owner) {
+        uint8_t priority = owner->priority;
+        InheritPriority(owner);
+        if (owner->priority == priority || !owner->blockedMutex) break;
+        owner = owner->blockedMutex->owner;
+    }
+    return;
+}
+
+// ReleaseHeldMutexes
+// Hands every mutex held by a thread that is being killed to its next waiter.
+// Call inside a critical section, before the thread is marked not alive.
+// Param tcb_t* "thread": thread being killed
+// Return: void
+void ReleaseHeldMutexes(tcb_t* thread) {
+    while (thread->heldMutexes) {
+        G8RTOS_Mutex_t* m = thread->heldMutexes;
+        thread->heldMutexes = m->nextHeld;
+        m->nextHeld = NULL;
+        HandOff(m);
+    }
+    /* The thread is off every list, so its priority can be reset directly. */
+    thread->priority = thread->basePriority;
+    return;
+}
@@ -0,0 +1,163 @@
+// G8RTOS_Notify.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for direct-to-thread notification functions. Every thread has a
+// 32-bit notification value in its TCB, which makes it a lighter counting
+// semaphore or event word for the common case of one ISR or thread waking
+// one handler thread: no semaphore object and no wait queue.
+
+#include "../G8RTOS_Notify.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_CriticalSection.h"
+
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+
+/*************************************Defines***************************************/
+
+// How Notify updates the value
+#define NOTIFY_INCREMENT        0
+#define NOTIFY_SET_BITS         1
+#define NOTIFY_OVERWRITE        2
+
+/*******************************Private Functions***********************************/
+
+// Notify
+// Updates a thread's notification value and makes it ready if it is
+// waiting in G8RTOS_NotifyTake and the value is now non-zero. From a
+// thread, switches to it if it outranks the caller; from an ISR, leaves
+// that to G8RTOS_ExitISR.
+// Param threadID_t "threadID": thread to notify
+// Param uint32_t "value": bits or value, unused for NOTIFY_INCREMENT
+// Param uint8_t "action": NOTIFY_INCREMENT, NOTIFY_SET_BITS or NOTIFY_OVERWRITE
+// Param bool "fromISR": called from an interrupt handler
+// Return: sched_ErrCode_t
+static sched_ErrCode_t Notify(threadID_t threadID, uint32_t value, uint8_t action, bool fromISR) {
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* thread = ThreadOfID(threadID);
+    if (!thread) {
+        EndCriticalSection(i_bit);
+        return THREAD_DOES_NOT_EXIST;
+    }
+    if (action == NOTIFY_INCREMENT) thread->notifyValue++;
+    else if (action == NOTIFY_SET_BITS) thread->notifyValue |= value;
+    else thread->notifyValue = value;
+    bool preempt = false;
+    if (thread->notifyWaiting && thread->notifyValue) {
+        thread->notifyWaiting = false;
+        AddToReadyList(thread);
+        preempt = (thread->priority < CurrentlyRunningThread->priority);
+        if (preempt && fromISR) {
+            RequestSwitchFromISR();
+            preempt = false;
+        }
+    }
+    EndCriticalSection(i_bit);
+    /* Run the woken thread right away if it is more important than this one. */
+    if (preempt) HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    return NO_ERROR;
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_NotifyGive
+// Increments a thread's notification value, like signalling a counting
+// semaphore owned by that thread.
+// Param "threadID": thread to notify
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_NotifyGive(threadID_t threadID) {
+    return Notify(threadID, NULL, NOTIFY_INCREMENT, false);
+}
+
+// G8RTOS_NotifyGiveFromISR
+// G8RTOS_NotifyGive for interrupt handlers, see G8RTOS_ExitISR.
+// Param "threadID": thread to notify
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_NotifyGiveFromISR(threadID_t threadID) {
+    return Notify(threadID, NULL, NOTIFY_INCREMENT, true);
+}
+
+// G8RTOS_NotifySetBits
+// ORs bits into a thread's notification value.
+// Param "threadID": thread to notify
+// Param "bits": bits to set
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_NotifySetBits(threadID_t threadID, uint32_t bits) {
+    return Notify(threadID, bits, NOTIFY_SET_BITS, false);
+}
+
+// G8RTOS_NotifySetBitsFromISR
+// G8RTOS_NotifySetBits for interrupt handlers, see G8RTOS_ExitISR.
+// Param "threadID": thread to notify
+// Param "bits": bits to set
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_NotifySetBitsFromISR(threadID_t threadID, uint32_t bits) {
+    return Notify(threadID, bits, NOTIFY_SET_BITS, true);
+}
+
+// G8RTOS_NotifyOverwrite
+// Replaces a thread's notification value, e.g. to pass the latest sample
+// like a one-word mailbox.
+// Param "threadID": thread to notify
+// Param "value": new value, 0 does not wake the thread
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_NotifyOverwrite(threadID_t threadID, uint32_t value) {
+    return Notify(threadID, value, NOTIFY_OVERWRITE, false);
+}
+
+// G8RTOS_NotifyOverwriteFromISR
+// G8RTOS_NotifyOverwrite for interrupt handlers, see G8RTOS_ExitISR.
+// Param "threadID": thread to notify
+// Param "value": new value, 0 does not wake the thread
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_NotifyOverwriteFromISR(threadID_t threadID, uint32_t value) {
+    return Notify(threadID, value, NOTIFY_OVERWRITE, true);
+}
+
+// G8RTOS_NotifyTake
+// Blocks until the calling thread's notification value is non-zero, then
+// decrements it, or clears it when "clearOnExit" is set.
+// Must not be called from an ISR.
+// Param "clearOnExit": clear the value instead of decrementing it
+// Return: uint32_t, the value before it was decremented or cleared
+uint32_t G8RTOS_NotifyTake(bool clearOnExit) {
+    uint32_t value;
+    G8RTOS_NotifyTakeTimeout(clearOnExit, WAIT_FOREVER, &value);
+    return value;
+}
+
+// G8RTOS_NotifyTakeTimeout
+// G8RTOS_NotifyTake that gives up after "timeout" systicks.
+// Param "clearOnExit": clear the value instead of decrementing it
+// Param "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Param "value": set to the value before it was decremented or cleared, 0 on a timeout
+// Return: sched_ErrCode_t, WAIT_TIMEOUT if the wait timed out
+sched_ErrCode_t G8RTOS_NotifyTakeTimeout(bool clearOnExit, uint32_t timeout, uint32_t* value) {
+    int32_t i_bit = StartCriticalSection();
+    if (!CurrentlyRunningThread->notifyValue) {
+        if (!timeout) {
+            EndCriticalSection(i_bit);
+            *value = NULL;
+            return WAIT_TIMEOUT;
+        }
+        CurrentlyRunningThread->notifyWaiting = true;
+        RemoveFromReadyList(CurrentlyRunningThread);
+        StartTimeout(CurrentlyRunningThread, timeout);
+        EndCriticalSection(i_bit);
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+        SWITCH_BARRIER();
+        /* Only made ready again once the value is non-zero, or at the timeout. */
+        i_bit = StartCriticalSection();
+        if (CurrentlyRunningThread->timedOut) {
+            EndCriticalSection(i_bit);
+            *value = NULL;
+            return WAIT_TIMEOUT;
+        }
+    }
+    *value = CurrentlyRunningThread->notifyValue;
+    CurrentlyRunningThread->notifyValue = clearOnExit ? NULL : *value - 1;
+    EndCriticalSection(i_bit);
+    return NO_ERROR;
+}
@@ -1,6 +1,6 @@
 // G8RTOS_Scheduler.c
 // Date Created: 2023-07-25
-// Date Updated: 2024-04-08
+// Date Updated: 2026-10-16
 // Defines for scheduler functions
 
 #include "../G8RTOS_Scheduler.h"
@@ -11,6 +11,11 @@
 #include <stdbool.h>
 
 #include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Mutex.h"
+#include "../G8RTOS_Timer.h"
+#include "../G8RTOS_Deferred.h"
+#include "../G8RTOS_Trace.h"
+#include "../G8RTOS_Cycles.h"
 
 #include <inc/hw_memmap.h>
 #include "inc/hw_types.h"
@@ -19,24 +24,105 @@
 #include "driverlib/systick.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/interrupt.h"
+#include "driverlib/fpu.h"
 
 /********************************Private Variables**********************************/
 
 // Thread Control Blocks - array to hold information for each thread
 static tcb_t threadControlBlocks[MAX_THREADS];
 
-// Thread Stacks - array of arrays for individual stacks of each thread
-static uint32_t threadStacks[MAX_THREADS][STACKSIZE];
+// Free TCBs, linked through nextTCB
+static tcb_t* FreeTCBs;
+
+// Stack Arena - every thread stack is carved from here. Declared as 64-bit
+// words so that each stack, and therefore each initial stack pointer, is
+// 8-byte aligned.
+static uint64_t StackArena[STACK_ARENA_SIZE / 2];
+
+// Free blocks of the stack arena, sorted by address. Each free block holds
+// its own link and size in its first two words.
+typedef struct stackBlock_t {
+    struct stackBlock_t *next;
+    uint32_t size;
+} stackBlock_t;
+static stackBlock_t* FreeStacks;
 
 // Periodic Event Threads - array to hold pertinent information for each thread
 static ptcb_t pthreadControlBlocks[MAX_PTHREADS];
 
+// Real-time Thread Control Blocks - periods, deadlines and job statistics
+static rtcb_t rtControlBlocks[MAX_RT_THREADS];
+
 // Current Number of Threads currently in the scheduler
 static uint32_t NumberOfThreads;
 
 // Current Number of Periodic Threads currently in the scheduler
 static uint32_t NumberOfPThreads;
 
+// Release Queue - delta list of periodic events sorted by next release. Each
+// event's releaseCount holds the ticks left after the event before it.
+static ptcb_t* ReleaseQueue;
+
+#if PERIODIC_DEFERRED
+// Released events waiting for the periodic thread, oldest first
+static ptcb_t* DueHead;
+static ptcb_t* DueTail;
+
+// Counts the events in the due list, the periodic thread blocks on it
+static semaphore_t PeriodicDue;
+#endif
+
+#if G8RTOS_TRACE
+// Handlers of aperiodic events, called through TracedISR
+static void (*TracedHandlers[NUM_INTERRUPTS])(void);
+#endif
+
+#if TICKLESS_IDLE
+// Longest idle period, in ticks, that fits in the 24-bit systick counter
+static uint32_t MaxIdleTicks;
+#endif
+
+// Ready Lists - circular doubly-linked list of ready threads for each priority
+static tcb_t* ReadyList[NUM_PRIORITIES];
+
+// Ready Bitmap - bit (31 - (priority % 32)) of word (priority / 32) is set
+// when the ready list for that priority is not empty
+static uint32_t ReadyBitmap[PRIORITY_GROUPS];
+
+// Ready Group - bit (31 - group) is set when ReadyBitmap[group] is not zero
+static uint32_t ReadyGroup;
+
+// Cycle counter value at the last G8RTOS_Scheduler call; the cycles since
+// then belong to the running thread
+static uint32_t LastSchedulerCycles;
+
+// Cycles accounted to all threads, and to idle threads, since G8RTOS_Init
+static uint64_t TotalCycles;
+static uint64_t IdleCycles;
+
+// CPU load window: ticks into the window, and the totals at its start
+static uint32_t LoadWindowTicks;
+static uint64_t WindowTotalCycles;
+static uint64_t WindowIdleCycles;
+
+// CPU load over the last complete window, in tenths of a percent
+static uint32_t CPULoad;
+
+// Cycles per systick, for real-time thread budgets
+static uint32_t CyclesPerTick;
+
+// Sleep List - delta list of sleeping threads sorted by wake-up time. Each
+// thread's sleepCount holds the ticks left after the thread before it.
+static tcb_t* SleepList;
+
+// Set by the FromISR calls when they ready a thread that outranks the
+// interrupted one, so G8RTOS_ExitISR pends PendSV once for all of them
+static bool SwitchPendingFromISR;
+
+// Thread ID map - TCB slot + 1 of the thread last added with each ID, so
+// threads can be addressed by ID without walking the TCB ring
+static uint8_t ThreadSlots[256];
+
 //static uint32_t threadCounter = 0;
 
 /*******************************Private Functions***********************************/
@@ -45,6 +131,7 @@ static uint32_t NumberOfPThreads;
 static void InitSysTick(void) {
     // Set systick period to overflow every 1 ms.
     SysTickPeriodSet((uint32_t) (SysCtlClockGet() / (float) 1000.0));
+    CyclesPerTick = SysTickPeriodGet();
     // Set systick interrupt handler
     SysTickIntRegister(SysTick_Handler);
     // Set pendsv handler
@@ -53,63 +140,703 @@ static void InitSysTick(void) {
     SysTickIntEnable();
     // Enable systick
     SysTickEnable();
+#if TICKLESS_IDLE
+    MaxIdleTicks = 0x00FFFFFF / SysTickPeriodGet();
+#endif
+    return;
+}
+
+// AllocateStack
+// First-fit allocation of a stack from the arena, splitting a larger free
+// block and leaving the remainder in the free list. Call inside a critical section.
+// Param uint32_t "size": stack size in words, even and at least MIN_STACKSIZE
+// Return: uint32_t*, lowest word of the stack, NULL if the arena is full
+static uint32_t* AllocateStack(uint32_t size) {
+    stackBlock_t** link = &FreeStacks;
+    while (*link && (*link)->size < size) link = &(*link)->next;
+    stackBlock_t* block = *link;
+    if (!block) return NULL;
+    if (block->size - size >= MIN_STACKSIZE) {
+        /* Hand out the top of the block so the free part keeps its header. */
+        block->size -= size;
+        return (uint32_t*)block + block->size;
+    }
+    *link = block->next;
+    return (uint32_t*)block;
+}
+
+// FreeStack
+// Returns a thread's stack to the arena, merging it with free neighbours.
+// Call inside a critical section.
+// Param tcb_t* "thread": thread whose stack is reclaimed
+// Return: void
+static void FreeStack(tcb_t* thread) {
+    stackBlock_t* block = (stackBlock_t*)thread->stackBase;
+    block->size = thread->stackSize;
+    thread->stackBase = NULL;
+    stackBlock_t** link = &FreeStacks;
+    stackBlock_t* previous = NULL;
+    while (*link && *link < block) {
+        previous = *link;
+        link = &(*link)->next;
+    }
+    block->next = *link;
+    *link = block;
+    // Merge with the following free block
+    if (block->next && (uint32_t*)block + block->size == (uint32_t*)block->next) {
+        block->size += (block->next)->size;
+        block->next = (block->next)->next;
+    }
+    // Merge into the preceding free block
+    if (previous && (uint32_t*)previous + previous->size == (uint32_t*)block) {
+        previous->size += block->size;
+        previous->next = block->next;
+    }
+    return;
+}
+
+// AddToSleepList
+// Inserts a thread into the sleep delta list so that it wakes after "ticks"
+// systicks. Walks only the sleepers due before it. Call inside a critical section.
+// Param tcb_t* "thread": thread to put to sleep
+// Param uint32_t "ticks": number of systicks until it is woken, at least 1
+// Return: void
+static void AddToSleepList(tcb_t* thread, uint32_t ticks) {
+    tcb_t* previous = NULL;
+    tcb_t* iter = SleepList;
+    /* Consume the deltas of the sleepers that wake up no later than this thread. */
+    while (iter && iter->sleepCount <= ticks) {
+        ticks -= iter->sleepCount;
+        previous = iter;
+        iter = iter->nextReadyTCB;
+    }
+    thread->sleepCount = ticks;
+    thread->previousReadyTCB = previous;
+    thread->nextReadyTCB = iter;
+    if (previous) previous->nextReadyTCB = thread;
+    else SleepList = thread;
+    if (iter) {
+        /* The thread after us now counts from our wake-up time. */
+        iter->sleepCount -= ticks;
+        iter->previousReadyTCB = thread;
+    }
+    return;
+}
+
+// RemoveFromSleepList
+// Unlinks a sleeping thread before its wake-up time, handing its remaining
+// delta to the next sleeper. Call inside a critical section.
+// Param tcb_t* "thread": sleeping thread to remove
+// Return: void
+static void RemoveFromSleepList(tcb_t* thread) {
+    if (thread->nextReadyTCB) {
+        (thread->nextReadyTCB)->sleepCount += thread->sleepCount;
+        (thread->nextReadyTCB)->previousReadyTCB = thread->previousReadyTCB;
+    }
+    if (thread->previousReadyTCB) (thread->previousReadyTCB)->nextReadyTCB = thread->nextReadyTCB;
+    else SleepList = thread->nextReadyTCB;
+    thread->nextReadyTCB = NULL;
+    thread->previousReadyTCB = NULL;
+    return;
+}
+
+// AddToReleaseQueue
+// Inserts a periodic event into the release delta list so that it is
+// released after "ticks" systicks. Call inside a critical section.
+// Param ptcb_t* "event": periodic event to schedule
+// Param uint32_t "ticks": number of systicks until its release, at least 1
+// Return: void
+static void AddToReleaseQueue(ptcb_t* event, uint32_t ticks) {
+    ptcb_t* previous = NULL;
+    ptcb_t* iter = ReleaseQueue;
+    while (iter && iter->releaseCount <= ticks) {
+        ticks -= iter->releaseCount;
+        previous = iter;
+        iter = iter->nextPTCB;
+    }
+    event->releaseCount = ticks;
+    event->previousPTCB = previous;
+    event->nextPTCB = iter;
+    if (previous) previous->nextPTCB = event;
+    else ReleaseQueue = event;
+    if (iter) {
+        iter->releaseCount -= ticks;
+        iter->previousPTCB = event;
+    }
+    return;
+}
+
+// RemoveFromReleaseQueue
+// Unlinks a periodic event, handing its remaining delta to the next event.
+// Call inside a critical section.
+// Param ptcb_t* "event": periodic event to remove
+// Return: void
+static void RemoveFromReleaseQueue(ptcb_t* event) {
+    if (event->nextPTCB) {
+        (event->nextPTCB)->releaseCount += event->releaseCount;
+        (event->nextPTCB)->previousPTCB = event->previousPTCB;
+    }
+    if (event->previousPTCB) (event->previousPTCB)->nextPTCB = event->nextPTCB;
+    else ReleaseQueue = event->nextPTCB;
+    event->nextPTCB = NULL;
+    event->previousPTCB = NULL;
+    return;
+}
+
+#if PERIODIC_DEFERRED
+// PeriodicThread
+// Kernel thread that runs released periodic event handlers, so that a long
+// handler does not stretch SysTick_Handler.
+// Return: void
+static void PeriodicThread(void) {
+    while (1) {
+        G8RTOS_WaitSemaphore(&PeriodicDue);
+        int32_t i_bit = StartCriticalSection();
+        ptcb_t* event = DueHead;
+        /* The event may have been removed after it was released. */
+        if (!event) {
+            EndCriticalSection(i_bit);
+            continue;
+        }
+        DueHead = event->nextDuePTCB;
+        if (!DueHead) DueTail = NULL;
+        event->isDue = false;
+        void (*handler)(void) = event->handler;
+        EndCriticalSection(i_bit);
+        handler();
+    }
+}
+#endif
+
+// FreeTCB
+// Returns a killed thread's stack to the arena, unless the caller owns it,
+// and its TCB to the free list. Call inside a critical section.
+// Param tcb_t* "thread": killed thread that is no longer running
+// Return: void
+static void FreeTCB(tcb_t* thread) {
+    if (!thread->staticStack) FreeStack(thread);
+    thread->stackBase = NULL;
+    thread->nextTCB = FreeTCBs;
+    FreeTCBs = thread;
+    return;
+}
+
+// CreateThread
+// Sets up a TCB from the free list and makes the thread ready.
+// Call inside a critical section.
+// Param void* "function": thread function
+// Param uint8_t "priority": priority from 0, 255
+// Param char* "name": thread name
+// Param uint8_t "threadID": ID, unique among live threads
+// Param uint32_t* "stack": caller-owned stack, NULL to carve one from the arena
+// Param uint32_t "stackSize": stack size in words, even and at least MIN_STACKSIZE
+// Param rtcb_t* "realTime": period and deadline of a real-time thread, else NULL
+// Return: sched_ErrCode_t
+static sched_ErrCode_t CreateThread(void (*function)(void), uint8_t priority, char* name, uint8_t threadID, uint32_t* stack, uint32_t stackSize, rtcb_t* realTime) {
+    if (!FreeTCBs) return THREAD_LIMIT_REACHED;
+    if (ThreadOfID(threadID)) return THREAD_ID_IN_USE;
+    bool staticStack = (stack != NULL);
+    if (!staticStack) stack = AllocateStack(stackSize);
+    if (!stack) return STACK_ARENA_FULL;
+    for (uint32_t i = NULL; i < stackSize; i++) stack[i] = STACK_FILL_PATTERN;
+    tcb_t* thread = FreeTCBs;
+    FreeTCBs = thread->nextTCB;
+    uint32_t slot = thread - threadControlBlocks;
+    /* Set up thread stack. */
+    thread->stackBase = stack;
+    thread->stackSize = stackSize;
+    thread->staticStack = staticStack;
+    SetInitialStack(slot);
+    /* Thread address saved onto the stack. */
+    stack[stackSize - 2] = (uint32_t)(uintptr_t)(function);
+    /* Set up thread info. */
+    thread->priority = priority;
+    thread->basePriority = priority;
+    /* Real-time threads run each job to completion unless preempted. */
+    thread->timeSlice = realTime ? NULL : TIME_SLICE;
+    thread->realTime = realTime;
+    if (realTime) realTime->thread = thread;
+    thread->ThreadID = threadID;
+    thread->runCycles = NULL;
+    thread->switchCount = NULL;
+    thread->preemptCount = NULL;
+    uint32_t index = NULL;
+    while (index < MAX_NAME_LENGTH && name[index] != '\0') {
+        thread->threadName[index] = name[index];
+        index++;
+    }
+    while (index < MAX_NAME_LENGTH) thread->threadName[index++] = '\0';
+    /* By default, threads should be awake and alive. */
+    thread->asleep = false;
+    thread->blocked = NULL;
+    thread->blockedMutex = NULL;
+    thread->heldMutexes = NULL;
+    thread->notifyValue = NULL;
+    thread->notifyWaiting = false;
+    thread->isAlive = true;
+    /* A new generation makes handles to the slot's previous thread stale. */
+    thread->generation++;
+    if (!thread->generation) thread->generation++;
+    ThreadSlots[threadID] = slot + 1;
+    AddToReadyList(thread);
+    NumberOfThreads++;
+    return NO_ERROR;
+}
+
+// CancelWait
+// Takes a thread out of the wait it is blocked in, when it is killed or
+// its timeout expires, undoing what the wait did to the semaphore or mutex.
+// Call inside a critical section.
+// Param tcb_t* "thread": thread to stop waiting
+// Return: void
+static void CancelWait(tcb_t* thread) {
+    // leave the wait queue of the semaphore, mutex or event group it is blocked on
+    if (thread->blocked) {
+        RemoveFromWaitQueue(thread);
+        (thread->blocked)->count++;
+    }
+    if (thread->blockedMutex) RemoveMutexWaiter(thread);
+    if (thread->waitQueue) RemoveFromWaitQueue(thread);
+    thread->blocked = NULL;
+    thread->notifyWaiting = false;
+    return;
+}
+
+// Kill
+// Kills a thread: takes it off the list it is in, releases its mutexes and
+// frees its TCB. The running thread keeps its stack until G8RTOS_Scheduler
+// has switched away from it. Call inside a critical section.
+// Param tcb_t* "thread": thread to kill, NULL if the lookup failed
+// Return: sched_ErrCode_t
+static sched_ErrCode_t Kill(tcb_t* thread) {
+    if (!thread) return THREAD_DOES_NOT_EXIST;
+    if (NumberOfThreads <= 1) return CANNOT_KILL_LAST_THREAD;
+    // take it off the ready or sleep list it is waiting in
+    if (thread->asleep) RemoveFromSleepList(thread);
+    else if (thread->isReady) RemoveFromReadyList(thread);
+    thread->asleep = false;
+    CancelWait(thread);
+    // hand any mutexes it holds to their next waiters, mark as not alive
+    ReleaseHeldMutexes(thread);
+    if (thread->realTime) {
+        (thread->realTime)->isActive = false;
+        thread->realTime = NULL;
+    }
+    thread->isAlive = false;
+    ThreadSlots[thread->ThreadID] = NULL;
+    NumberOfThreads--;
+    /* Switch away from a thread that killed itself, it is freed then. */
+    if (thread == CurrentlyRunningThread) HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    else FreeTCB(thread);
+    return NO_ERROR;
+}
+
+// WaitForSwitch
+// Called by the kill functions outside their critical section. The PendSV
+// that Kill pended for a thread that killed itself has already switched
+// away, unless no thread was ready: then the dead thread waits here, on its
+// stack, until the systick or an interrupt readies one. A handler that
+// killed the thread it interrupted returns instead, as PendSV cannot run
+// until it does.
+// Param sched_ErrCode_t "status": result of Kill
+// Return: void
+static void WaitForSwitch(sched_ErrCode_t status) {
+    if (status == NO_ERROR && !CurrentlyRunningThread->isAlive && !InHandlerMode()) {
+        while (1);
+    }
+    return;
+}
+
+// HandleOf
+// Builds the handle of a live thread from its TCB slot and generation.
+// Param tcb_t* "thread": live thread
+// Return: threadHandle_t
+static inline threadHandle_t HandleOf(tcb_t* thread) {
+    return ((uint32_t)thread->generation << HANDLE_SLOT_BITS) | (uint32_t)(thread - threadControlBlocks);
+}
+
+#if RT_POLICY == RT_POLICY_EDF
+// EarlierDeadline
+// Checks whether a real-time thread's job is due before another ready
+// thread's; threads that are not real-time are never due.
+// Param tcb_t* "thread": real-time thread
+// Param tcb_t* "other": thread to compare with
+// Return: bool
+static bool EarlierDeadline(tcb_t* thread, tcb_t* other) {
+    if (!other->realTime) return true;
+    return (int32_t)((thread->realTime)->absoluteDeadline - (other->realTime)->absoluteDeadline) < 0;
+}
+#endif
+
+// Admissible
+// Admission control: checks that the real-time threads stay schedulable
+// under RT_POLICY with one more added. Both policies first need total
+// utilization of at most 100%. Rate-monotonic then runs response-time
+// analysis in priority order; EDF needs the densities, budget over the
+// shorter of deadline and period, to sum to at most 100%, which is exact
+// when deadlines equal periods. Call inside a critical section.
+// Param rtcb_t* "candidate": free RTCB holding the new thread's parameters
+// Return: bool
+static bool Admissible(rtcb_t* candidate) {
+    uint32_t period[MAX_RT_THREADS];
+    uint32_t budget[MAX_RT_THREADS];
+    uint32_t deadline[MAX_RT_THREADS];
+    uint32_t n = NULL;
+    uint64_t utilization = NULL;    // Parts per million, rounded up
+#if RT_POLICY == RT_POLICY_EDF
+    uint64_t density = NULL;
+#endif
+    for (uint32_t i = NULL; i < MAX_RT_THREADS; i++) {
+        rtcb_t* rt = &rtControlBlocks[i];
+        if (!rt->isActive && rt != candidate) continue;
+        utilization += ((uint64_t)rt->budget * 1000000 + rt->period - 1) / rt->period;
+#if RT_POLICY == RT_POLICY_EDF
+        density += ((uint64_t)rt->budget * 1000000 + rt->deadline - 1) / rt->deadline;
+#endif
+        /* Insertion sort into priority order, as RankRealTimeThreads assigns it. */
+        uint32_t j = n++;
+        while (j && (deadline[j - 1] > rt->deadline || (deadline[j - 1] == rt->deadline && period[j - 1] > rt->period))) {
+            period[j] = period[j - 1];
+            budget[j] = budget[j - 1];
+            deadline[j] = deadline[j - 1];
+            j--;
+        }
+        period[j] = rt->period;
+        budget[j] = rt->budget;
+        deadline[j] = rt->deadline;
+    }
+    if (utilization > 1000000) return false;
+#if RT_POLICY == RT_POLICY_EDF
+    return density <= 1000000;
+#else
+    /* Worst-case response time: the budget plus every release of each
+     * higher priority thread within it, iterated to a fixed point. */
+    for (uint32_t i = NULL; i < n; i++) {
+        uint32_t response = budget[i];
+        uint32_t previous = NULL;
+        while (response != previous) {
+            if (response > deadline[i]) return false;
+            previous = response;
+            response = budget[i];
+            for (uint32_t j = NULL; j < i; j++) response += ((previous + period[j] - 1) / period[j]) * budget[j];
+        }
+    }
+    return true;
+#endif
+}
+
+// RankRealTimeThreads
+// Gives each real-time thread its rate-monotonic base priority: shorter
+// deadlines, then shorter periods, then older slots come first. Keeps any
+// priority a thread has inherited. Call inside a critical section.
+// Return: void
+static void RankRealTimeThreads(void) {
+    for (uint32_t i = NULL; i < MAX_RT_THREADS; i++) {
+        rtcb_t* rt = &rtControlBlocks[i];
+        if (!rt->isActive) continue;
+        uint32_t rank = NULL;
+        for (uint32_t j = NULL; j < MAX_RT_THREADS; j++) {
+            rtcb_t* other = &rtControlBlocks[j];
+            if (!other->isActive || other == rt) continue;
+            if (other->deadline < rt->deadline ||
+                (other->deadline == rt->deadline && (other->period < rt->period || (other->period == rt->period && j < i)))) {
+                rank++;
+            }
+        }
+        tcb_t* thread = rt->thread;
+        if (thread->basePriority != RT_PRIORITY_BASE + rank) {
+            thread->basePriority = RT_PRIORITY_BASE + rank;
+            InheritPriority(thread);
+        }
+    }
+    return;
+}
+
+// ChargeRunningThread
+// Charges the cycles since the last charge to the running thread. The
+// counter is only 32 bits wide, so this has to happen at least once per
+// window; the unsigned subtraction handles one wrap in between.
+// Return: void
+static void ChargeRunningThread(void) {
+    uint32_t now = CYCLE_COUNT();
+    uint32_t elapsed = now - LastSchedulerCycles;
+    LastSchedulerCycles = now;
+    CurrentlyRunningThread->runCycles += elapsed;
+    TotalCycles += elapsed;
+    if (CurrentlyRunningThread->basePriority == IDLE_PRIORITY) IdleCycles += elapsed;
+    return;
+}
+
+// UpdateCPULoad
+// Closes the current load window: the load is the share of the cycles in
+// the window that were not spent in idle threads. Without preemption the
+// scheduler may not have run all window, so the running thread's slice so
+// far is charged first.
+// Return: void
+static void UpdateCPULoad(void) {
+    ChargeRunningThread();
+    uint64_t total = TotalCycles - WindowTotalCycles;
+    uint64_t idle = IdleCycles - WindowIdleCycles;
+    if (total) CPULoad = 1000 - (uint32_t)(idle * 1000 / total);
+    WindowTotalCycles = TotalCycles;
+    WindowIdleCycles = IdleCycles;
+    LoadWindowTicks = NULL;
+    return;
+}
+
+// HighestReadyPriority
+// Finds the highest (numerically lowest) priority with a ready thread.
+// Two CLZs on the bitmap, so this takes constant time.
+// Return: uint32_t
+static uint32_t HighestReadyPriority(void) {
+    uint32_t group = CLZ(ReadyGroup);
+    return (group << 5) + CLZ(ReadyBitmap[group]);
+}
+
+#if TICKLESS_IDLE
+// NextDeadline
+// Number of systicks until the first sleeper wakes, periodic event runs or
+// software timer expires, capped at what the systick counter can hold.
+// Return: uint32_t
+static uint32_t NextDeadline(void) {
+    uint32_t ticks = MaxIdleTicks;
+    if (SleepList && SleepList->sleepCount < ticks) ticks = SleepList->sleepCount;
+    if (ReleaseQueue && ReleaseQueue->releaseCount < ticks) ticks = ReleaseQueue->releaseCount;
+#if SOFTWARE_TIMERS
+    if (NextTimerExpiry() < ticks) ticks = NextTimerExpiry();
+#endif
+    return ticks;
+}
+
+// StepTickCount
+// Accounts for ticks that passed while the systick interrupt was suppressed.
+// Never reaches a deadline, so no thread or periodic event is due afterwards.
+// Param uint32_t "ticks": number of ticks skipped
+// Return: void
+static void StepTickCount(uint32_t ticks) {
+    SystemTime += ticks;
+    LoadWindowTicks += ticks;
+    if (SleepList) SleepList->sleepCount -= ticks;
+    if (ReleaseQueue) ReleaseQueue->releaseCount -= ticks;
+#if SOFTWARE_TIMERS
+    StepTimers(ticks);
+#endif
+    return;
+}
+
+// WaitForInterrupt
+// Sleeps in WFI inside a critical section. Interrupts masked by BASEPRI do
+// not wake WFI, so under KERNEL_BASEPRI the kernel mask is moved to PRIMASK
+// for the sleep. A pending interrupt is still taken only after the critical
+// section, except one above OSINT_PRIORITY, which is taken right away.
+// Return: void
+static void WaitForInterrupt(void) {
+#if KERNEL_BASEPRI
+    IntMasterDisable();
+    IntPriorityMaskSet(NULL);
+    SysCtlSleep();
+    IntPriorityMaskSet(KERNEL_BASEPRI_CEILING);
+    IntMasterEnable();
+#else
+    SysCtlSleep();
+#endif
+    return;
+}
+
+// SuppressTicks
+// Reprograms the systick to fire once after "idleTicks" ticks, keeping the
+// phase of the 1 ms tick, then waits in WFI. Runs with interrupts disabled,
+// so any interrupt wakes the core but is only taken after the critical section.
+// Param uint32_t "idleTicks": ticks until the next deadline, at least 2
+// Return: void
+static void SuppressTicks(uint32_t idleTicks) {
+    uint32_t period = SysTickPeriodGet();
+    // Stretch the current tick to end on the deadline's tick boundary.
+    SysTickDisable();
+    SysTickPeriodSet(SysTickValueGet() + (idleTicks - 1) * period);
+    HWREG(NVIC_ST_CURRENT) = NULL;
+    SysTickEnable();
+    /* The reload only takes effect after the long count wraps. */
+    SysTickPeriodSet(period);
+    WaitForInterrupt();
+    SysTickDisable();
+    if (HWREG(NVIC_ST_CTRL) & NVIC_ST_CTRL_COUNT) {
+        // Woken by the systick itself: its pending interrupt counts the last tick.
+        SysTickEnable();
+        StepTickCount(idleTicks - 1);
+    } else {
+        // Woken early by another interrupt: count the whole ticks that passed
+        // and let the systick finish the tick in progress.
+        uint32_t remaining = SysTickValueGet();
+        uint32_t ticksLeft = (remaining + period - 1) / period;
+        SysTickPeriodSet(remaining - (ticksLeft - 1) * period);
+        HWREG(NVIC_ST_CURRENT) = NULL;
+        SysTickEnable();
+        SysTickPeriodSet(period);
+        StepTickCount(idleTicks - ticksLeft);
+    }
     return;
 }
 
+// IdleThread
+// Kernel idle thread. When it is the only ready thread, the systick is
+// suppressed until the next deadline instead of firing every 1 ms.
+// Return: void
+static void IdleThread(void) {
+    while (1) {
+        int32_t i_bit = StartCriticalSection();
+        tcb_t* idle = ReadyList[IDLE_PRIORITY];
+        if (HighestReadyPriority() == IDLE_PRIORITY && idle->nextReadyTCB == idle) {
+            uint32_t idleTicks = NextDeadline();
+            if (idleTicks >= 2) SuppressTicks(idleTicks);
+            else WaitForInterrupt();
+        }
+        EndCriticalSection(i_bit);
+    }
+}
+#endif
+
+#if G8RTOS_TRACE
+// TracedISR
+// Vector of every aperiodic event while tracing. Records the interrupt's
+// entry and exit around the handler registered for the active vector.
+// Return: void
+static void TracedISR(void) {
+    uint32_t vector = HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_VEC_ACT_M;
+    TRACE(TRACE_ISR_ENTER, vector);
+    TracedHandlers[vector]();
+    TRACE(TRACE_ISR_EXIT, vector);
+    return;
+}
+#endif
+
 
 /********************************Public Variables***********************************/
 
 uint32_t SystemTime;
 tcb_t* CurrentlyRunningThread;
-tcb_t* threadHead;
-tcb_t* threadTail;
 
 /********************************Public Functions***********************************/
 
 // SysTick_Handler
-// Increments system time, sets PendSV flag to start scheduler.
+// Increments system time, wakes sleepers, releases periodic events and
+// counts down the running thread's time slice. Sets the PendSV flag only
+// when the thread that should run has changed.
 // Return: void
 void SysTick_Handler(void) {
-    // Traverse the linked-list to find which threads should be awake.
-    /* Currently running thread should be put to sleep now, so search linked list for other threads. */
-    tcb_t* t_iter = CurrentlyRunningThread->nextTCB;
-    while (t_iter != CurrentlyRunningThread) {
-        /* If a thread has finished its sleep count, wake it up. */
-        if (t_iter->sleepCount == SystemTime) t_iter->asleep = false;
-        t_iter = t_iter->nextTCB;
-    }
-    // Traverse the periodic linked list to run which functions need to be run.
-    for (uint32_t i = NULL; i < NumberOfPThreads; i++) {
-        if (SystemTime == pthreadControlBlocks[i].currentTime) {
-            pthreadControlBlocks[i].handler();
+    TRACE(TRACE_ISR_ENTER, FAULT_SYSTICK);
+    // Count down the first sleeper and wake every thread that is now due.
+    /* Only the head of the delta list is touched unless threads are waking up. */
+    if (SleepList) {
+        SleepList->sleepCount--;
+        while (SleepList && !SleepList->sleepCount) {
+            tcb_t* t_wake = SleepList;
+            SleepList = t_wake->nextReadyTCB;
+            if (SleepList) SleepList->previousReadyTCB = NULL;
+            t_wake->asleep = false;
+            /* A thread still blocked when its timeout expires gives up the wait. */
+            if (t_wake->waitQueue || t_wake->notifyWaiting) {
+                CancelWait(t_wake);
+                t_wake->timedOut = true;
+            }
+            AddToReadyList(t_wake);
+            TRACE(TRACE_WAKE, t_wake->ThreadID);
+        }
+    }
+    // Count down the first periodic event and release every event that is now due.
+    if (ReleaseQueue) {
+        ReleaseQueue->releaseCount--;
+        while (ReleaseQueue && !ReleaseQueue->releaseCount) {
+            ptcb_t* p_release = ReleaseQueue;
+            RemoveFromReleaseQueue(p_release);
+            TRACE(TRACE_PERIODIC_RELEASE, p_release - pthreadControlBlocks);
             /* Configure the next time it runs */
-            pthreadControlBlocks[i].currentTime = SystemTime + pthreadControlBlocks[i].period;
+            AddToReleaseQueue(p_release, p_release->period);
+#if PERIODIC_DEFERRED
+            /* An event still waiting from its last release is not queued twice. */
+            if (!p_release->isDue) {
+                p_release->isDue = true;
+                p_release->nextDuePTCB = NULL;
+                if (DueTail) DueTail->nextDuePTCB = p_release;
+                else DueHead = p_release;
+                DueTail = p_release;
+                G8RTOS_SignalSemaphore(&PeriodicDue);
+            }
+#else
+            p_release->handler();
+#endif
         }
     }
     SystemTime++;
-    HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+#if SOFTWARE_TIMERS
+    TimerTick();
+#endif
+    if (++LoadWindowTicks >= LOAD_WINDOW_TICKS) UpdateCPULoad();
+    // Once the running thread's slice is used up, the next thread of the
+    // same priority moves to the head of the ready list.
+    tcb_t* running = CurrentlyRunningThread;
+    if (running->isReady && running->timeSlice && !--(running->sliceRemaining)) {
+        running->sliceRemaining = running->timeSlice;
+        ReadyList[running->priority] = running->nextReadyTCB;
+    }
+    /* Only switch if a wake-up, release or expired slice changed the thread to run. */
+    if (ReadyGroup && ReadyList[HighestReadyPriority()] != running) {
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    }
+    TRACE(TRACE_ISR_EXIT, FAULT_SYSTICK);
     return;
 }
 
 // G8RTOS_Init
-// Initializes the RTOS by initializing system time.
+// Initializes the RTOS by initializing system time. The vector table is
+// moved to SRAM by driverlib on the first IntRegister call.
 // Return: void
 void G8RTOS_Init(void) {
-    uint32_t newVTORTable = 0x20000000;
-    uint32_t* newTable = (uint32_t*)newVTORTable;
-    uint32_t* oldTable = (uint32_t*) 0;
-
-    for (uint8_t i = 0; i < 155; i++) {
-        newTable[i] = oldTable[i];
-    }
-
-    HWREG(NVIC_VTABLE) = newVTORTable;
-
+    // Threads that use the FPU get their registers saved on exception entry,
+    // lazily so that handlers which do not use it pay nothing
+    FPUEnable();
+    FPULazyStackingEnable();
     SystemTime = NULL;
     NumberOfThreads = NULL;
     NumberOfPThreads = NULL;
-    threadHead = NULL;
-    threadTail = NULL;
+    ReleaseQueue = NULL;
+    for (uint32_t i = NULL; i < MAX_PTHREADS; i++) pthreadControlBlocks[i].isActive = false;
+    for (uint32_t i = NULL; i < MAX_RT_THREADS; i++) rtControlBlocks[i].isActive = false;
+    for (uint32_t i = NULL; i < 256; i++) ThreadSlots[i] = NULL;
+    SleepList = NULL;
+    ReadyGroup = NULL;
+    for (uint32_t i = NULL; i < PRIORITY_GROUPS; i++) ReadyBitmap[i] = NULL;
+    for (uint32_t i = NULL; i < NUM_PRIORITIES; i++) ReadyList[i] = NULL;
+    FreeTCBs = NULL;
+    for (uint32_t i = MAX_THREADS; i > NULL; i--) {
+        threadControlBlocks[i - 1].isAlive = false;
+        threadControlBlocks[i - 1].nextTCB = FreeTCBs;
+        FreeTCBs = &threadControlBlocks[i - 1];
+    }
+    // The whole arena starts out as one free block
+    FreeStacks = (stackBlock_t*)StackArena;
+    FreeStacks->next = NULL;
+    FreeStacks->size = (STACK_ARENA_SIZE / 2) * 2;
+#if TICKLESS_IDLE
+    /* The kernel idle thread is the first thread and is never killed. */
+    G8RTOS_AddThread(IdleThread, IDLE_PRIORITY, "idle", IDLE_THREAD_ID, MIN_STACKSIZE);
+#endif
+#if PERIODIC_DEFERRED
+    DueHead = NULL;
+    DueTail = NULL;
+    G8RTOS_InitSemaphore(&PeriodicDue, NULL);
+    G8RTOS_AddThread(PeriodicThread, PERIODIC_PRIORITY, "periodic", PERIODIC_THREAD_ID, NULL);
+#endif
+#if SOFTWARE_TIMERS
+    InitTimerService();
+#endif
+#if DEFERRED_WORK
+    InitDeferredWork();
+#endif
+    CYCLE_COUNT_INIT();
+#if G8RTOS_TRACE
+    G8RTOS_TraceInit();
+#endif
     return;
 }
 
@@ -117,15 +844,18 @@ void G8RTOS_Init(void) {
 // Launches the RTOS.
 // Return: error codes, 0 if none
 int32_t G8RTOS_Launch(void) {
+    // Set currently running thread to the highest priority ready thread
+    if (!ReadyGroup) return NO_THREADS_SCHEDULED;
+    CurrentlyRunningThread = ReadyList[HighestReadyPriority()];
+    CurrentlyRunningThread->switchCount++;
+    LastSchedulerCycles = CYCLE_COUNT();
     // Initialize system tick
     InitSysTick();
-    // Set currently running thread to the first control block
-    CurrentlyRunningThread = threadHead;
     // Set interrupt priorities
        // Pendsv
-    IntPrioritySet(FAULT_PENDSV, 0xE0); /* 0xE0 is lowest priority. */
+    IntPrioritySet(FAULT_PENDSV, 7 << HWI_PRIORITY_SHIFT); /* 0xE0 is lowest priority. */
        // Systick
-    IntPrioritySet(FAULT_SYSTICK, 0xE0);
+    IntPrioritySet(FAULT_SYSTICK, 7 << HWI_PRIORITY_SHIFT);
     // Call G8RTOS_Start()
     G8RTOS_Start();
     return NO_ERROR;
@@ -133,129 +863,395 @@ int32_t G8RTOS_Launch(void) {
 
 // G8RTOS_Scheduler
 // Chooses next thread in the TCB. This time uses priority scheduling.
+// The highest ready priority is found from the ready bitmap, and the thread
+// at the head of its ready list runs.
 // Return: void
 void G8RTOS_Scheduler(void) {
-    // Using priority, determine the most eligible thread to run that
-    // is not blocked or asleep. Set current thread to this thread's TCB.
-    uint16_t min_priority = 256;
-    tcb_t* iter = CurrentlyRunningThread->nextTCB;
-    tcb_t* eligible_thread = CurrentlyRunningThread;
-    for (uint32_t i = NULL; i < NumberOfThreads - 1; i++) {
-        if (!iter->asleep && !iter->blocked && (iter->priority < min_priority)) {
-            min_priority = iter->priority;
-            eligible_thread = iter;
-        }
-        iter = iter->nextTCB;
+    // Charge the cycles since the last call to the thread that was running.
+    ChargeRunningThread();
+    SwitchPendingFromISR = false;
+    /* No thread is ready, so keep running the current one. A thread that
+     * killed itself waits in WaitForSwitch, still on its stack. */
+    if (!ReadyGroup) return;
+    /* The head of each ready list is the thread whose turn it is; the
+     * systick rotates the list when the running thread's slice expires. */
+    tcb_t* eligible_thread = ReadyList[HighestReadyPriority()];
+    /* A thread that killed itself is left for good, so reclaim it now. */
+    if (!CurrentlyRunningThread->isAlive && CurrentlyRunningThread->stackBase) FreeTCB(CurrentlyRunningThread);
+    if (eligible_thread != CurrentlyRunningThread) {
+        TRACE(TRACE_SWITCH, eligible_thread->ThreadID);
+        if (CurrentlyRunningThread->isReady) CurrentlyRunningThread->preemptCount++;
+        eligible_thread->switchCount++;
     }
     CurrentlyRunningThread = eligible_thread;
     return;
 }
 
+// AddToReadyList
+// Appends a thread to the tail of the ready list of its priority and
+// marks that priority as ready in the bitmap. Call inside a critical section.
+// Param tcb_t* "thread": thread that has become ready
+// Return: void
+void AddToReadyList(tcb_t* thread) {
+    /* A thread readied before its timeout expired leaves the sleep list. */
+    if (thread->asleep) {
+        RemoveFromSleepList(thread);
+        thread->asleep = false;
+    }
+    uint8_t priority = thread->priority;
+    tcb_t* head = ReadyList[priority];
+    if (!head) {
+        thread->nextReadyTCB = thread;
+        thread->previousReadyTCB = thread;
+        ReadyList[priority] = thread;
+        ReadyBitmap[priority >> 5] |= 0x80000000 >> (priority & 31);
+        ReadyGroup |= 0x80000000 >> (priority >> 5);
+    } else {
+        /* The tail of a circular list is the node before the head. */
+        tcb_t* next = head;
+#if RT_POLICY == RT_POLICY_EDF
+        /* Real-time threads are kept in deadline order ahead of the others,
+         * so the head is the job that is due first. */
+        if (thread->realTime) {
+            if (EarlierDeadline(thread, head)) {
+                ReadyList[priority] = thread;
+            } else {
+                next = head->nextReadyTCB;
+                while (next != head && !EarlierDeadline(thread, next)) next = next->nextReadyTCB;
+            }
+        }
+#endif
+        thread->nextReadyTCB = next;
+        thread->previousReadyTCB = next->previousReadyTCB;
+        (next->previousReadyTCB)->nextReadyTCB = thread;
+        next->previousReadyTCB = thread;
+    }
+    thread->isReady = true;
+    thread->sliceRemaining = thread->timeSlice;
+    return;
+}
+
+// RemoveFromReadyList
+// Unlinks a thread from the ready list of its priority, clearing the
+// bitmap bits once the list is empty. Call inside a critical section.
+// Param tcb_t* "thread": thread that is no longer ready
+// Return: void
+void RemoveFromReadyList(tcb_t* thread) {
+    uint8_t priority = thread->priority;
+    if (thread->nextReadyTCB == thread) {
+        ReadyList[priority] = NULL;
+        ReadyBitmap[priority >> 5] &= ~(0x80000000 >> (priority & 31));
+        if (!ReadyBitmap[priority >> 5]) ReadyGroup &= ~(0x80000000 >> (priority >> 5));
+    } else {
+        (thread->previousReadyTCB)->nextReadyTCB = thread->nextReadyTCB;
+        (thread->nextReadyTCB)->previousReadyTCB = thread->previousReadyTCB;
+        if (ReadyList[priority] == thread) ReadyList[priority] = thread->nextReadyTCB;
+    }
+    thread->nextReadyTCB = NULL;
+    thread->previousReadyTCB = NULL;
+    thread->isReady = false;
+    return;
+}
+
+// AddToWaitQueue
+// Inserts a thread into a wait queue behind every waiter of the same or
+// higher priority, so the head is always the next thread to wake.
+// Call inside a critical section.
+// Param tcb_t** "queue": head of the wait queue
+// Param tcb_t* "thread": thread that is blocking
+// Return: void
+void AddToWaitQueue(tcb_t** queue, tcb_t* thread) {
+    tcb_t* previous = NULL;
+    tcb_t* iter = *queue;
+    while (iter && iter->priority <= thread->priority) {
+        previous = iter;
+        iter = iter->nextWaitTCB;
+    }
+    thread->previousWaitTCB = previous;
+    thread->nextWaitTCB = iter;
+    thread->waitQueue = queue;
+    if (previous) previous->nextWaitTCB = thread;
+    else *queue = thread;
+    if (iter) iter->previousWaitTCB = thread;
+    return;
+}
+
+// RemoveFromWaitQueue
+// Unlinks a thread from anywhere in the wait queue it is in, in constant time.
+// Call inside a critical section.
+// Param tcb_t* "thread": thread to unlink
+// Return: void
+void RemoveFromWaitQueue(tcb_t* thread) {
+    if (thread->previousWaitTCB) (thread->previousWaitTCB)->nextWaitTCB = thread->nextWaitTCB;
+    else *(thread->waitQueue) = thread->nextWaitTCB;
+    if (thread->nextWaitTCB) (thread->nextWaitTCB)->previousWaitTCB = thread->previousWaitTCB;
+    thread->nextWaitTCB = NULL;
+    thread->previousWaitTCB = NULL;
+    thread->waitQueue = NULL;
+    return;
+}
+
+// InHandlerMode
+// Checks whether the caller is an interrupt handler rather than a thread.
+// Return: bool
+bool InHandlerMode(void) {
+    return (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_VEC_ACT_M) != NULL;
+}
+
+// RequestSwitchFromISR
+// Notes that an interrupt handler readied a thread that outranks the
+// interrupted one. Call inside a critical section.
+// Return: void
+void RequestSwitchFromISR(void) {
+    SwitchPendingFromISR = true;
+    return;
+}
+
+// StartTimeout
+// Bounds the wait a thread has just blocked in: it is also put in the sleep
+// list, so the systick wakes it with timedOut set unless it is readied first.
+// Call inside a critical section, after the thread has joined the wait.
+// Param tcb_t* "thread": thread that is blocking
+// Param uint32_t "ticks": timeout in systicks, at least 1, or WAIT_FOREVER
+// Return: void
+void StartTimeout(tcb_t* thread, uint32_t ticks) {
+    thread->timedOut = false;
+    if (ticks == WAIT_FOREVER) return;
+    thread->asleep = true;
+    AddToSleepList(thread, ticks);
+    return;
+}
+
+// ThreadOfID
+// Finds a live thread by ID through the thread ID map, in constant time.
+// Call inside a critical section.
+// Param threadID_t "threadID": ID of the thread
+// Return: tcb_t*, NULL if no live thread has the ID
+tcb_t* ThreadOfID(threadID_t threadID) {
+    if ((uint32_t)threadID > 0xFF || !ThreadSlots[threadID]) return NULL;
+    tcb_t* thread = &threadControlBlocks[ThreadSlots[threadID] - 1];
+    if (!thread->isAlive || thread->ThreadID != threadID) return NULL;
+    return thread;
+}
+
+// ThreadOfHandle
+// Finds a live thread by handle, in constant time. Call inside a critical section.
+// Param threadHandle_t "handle": handle from G8RTOS_AddThreadHandle or G8RTOS_GetThreadHandle
+// Return: tcb_t*, NULL if the handle is stale or invalid
+tcb_t* ThreadOfHandle(threadHandle_t handle) {
+    uint32_t slot = handle & ((1 << HANDLE_SLOT_BITS) - 1);
+    if (slot >= MAX_THREADS) return NULL;
+    tcb_t* thread = &threadControlBlocks[slot];
+    if (!thread->isAlive || thread->generation != (handle >> HANDLE_SLOT_BITS)) return NULL;
+    return thread;
+}
+
+// SetThreadPriority
+// Changes the effective priority of a thread, moving it to the matching
+// ready list or re-sorting it in its wait queue. Call inside a critical section.
+// Param tcb_t* "thread": thread to change
+// Param uint8_t "priority": new effective priority
+// Return: void
+void SetThreadPriority(tcb_t* thread, uint8_t priority) {
+    if (thread->priority == priority) return;
+    if (thread->waitQueue) {
+        tcb_t** queue = thread->waitQueue;
+        RemoveFromWaitQueue(thread);
+        thread->priority = priority;
+        AddToWaitQueue(queue, thread);
+    } else if (thread->isReady) {
+        RemoveFromReadyList(thread);
+        thread->priority = priority;
+        AddToReadyList(thread);
+    } else {
+        thread->priority = priority;
+    }
+    return;
+}
+
 // SetInitialStack
 // Creates an initial stack for a particular thread in such a way that it looks like
 // it has already been running and previously suspended.
 // Based on function of same name in the uP2 textbook / lecture notes.
 // Return: void
 void SetInitialStack(unsigned int index) {
-    threadControlBlocks[index].stackPointer = (void*)&threadStacks[index][STACKSIZE - 16]; // Thread stack pointer
-    /* The values chosen below do not matter and are for debugging purposes. */
-    threadStacks[index][STACKSIZE - 1]  = THUMBBIT;   // PSR
-    threadStacks[index][STACKSIZE - 2]  = 0x15151515; // PC (R15)
-    threadStacks[index][STACKSIZE - 3]  = 0x14141414; // LR (R14)
-    threadStacks[index][STACKSIZE - 4]  = 0x12121212; // R12
-    threadStacks[index][STACKSIZE - 5]  = 0x03030303; // R3
-    threadStacks[index][STACKSIZE - 6]  = 0x02020202; // R2
-    threadStacks[index][STACKSIZE - 7]  = 0x01010101; // R1
-    threadStacks[index][STACKSIZE - 8]  = 0x00000001; // R0
-    threadStacks[index][STACKSIZE - 9]  = 0x11111111; // R11
-    threadStacks[index][STACKSIZE - 10] = 0x10101010; // R10
-    threadStacks[index][STACKSIZE - 11] = 0x09090909; // R9
-    threadStacks[index][STACKSIZE - 12] = 0x08080808; // R8
-    threadStacks[index][STACKSIZE - 13] = 0x07070707; // R7
-    threadStacks[index][STACKSIZE - 14] = 0x06060606; // R6
-    threadStacks[index][STACKSIZE - 15] = 0x05050505; // R5
-    threadStacks[index][STACKSIZE - 16] = 0x04040404; // R4
+    uint32_t* stack = threadControlBlocks[index].stackBase;
+    uint32_t size = threadControlBlocks[index].stackSize;
+    threadControlBlocks[index].stackPointer = &stack[size - 18]; // Thread stack pointer
+    /* The values chosen below do not matter and are for debugging purposes.
+     * New threads get a basic frame; PendSV saves S16-S31 below the saved
+     * EXC_RETURN only once a thread has used the FPU. */
+    stack[size - 1]  = THUMBBIT;   // PSR
+    stack[size - 2]  = 0x15151515; // PC (R15)
+    stack[size - 3]  = 0x14141414; // LR (R14)
+    stack[size - 4]  = 0x12121212; // R12
+    stack[size - 5]  = 0x03030303; // R3
+    stack[size - 6]  = 0x02020202; // R2
+    stack[size - 7]  = 0x01010101; // R1
+    stack[size - 8]  = 0x00000001; // R0
+    stack[size - 9]  = EXC_RETURN_THREAD; // EXC_RETURN
+    stack[size - 10] = 0x11111111; // R11
+    stack[size - 11] = 0x10101010; // R10
+    stack[size - 12] = 0x09090909; // R9
+    stack[size - 13] = 0x08080808; // R8
+    stack[size - 14] = 0x07070707; // R7
+    stack[size - 15] = 0x06060606; // R6
+    stack[size - 16] = 0x05050505; // R5
+    stack[size - 17] = 0x04040404; // R4
+    stack[size - 18] = 0x03030303; // Pad, keeps the frame 8-byte aligned
     return;
 }
 
 // G8RTOS_AddThread
 // Adds a thread. This is now in a critical section to support dynamic threads.
 // It also now should initialize priority and account for live or dead threads.
+// The stack is carved from the stack arena and painted with STACK_FILL_PATTERN.
+// Param void* "threadToAdd": pointer to thread function address
+// Param uint8_t "priority": priority from 0, 255.
+// Param char* "name": character array containing the thread name.
+// Param uint8_t "threadID": ID, unique among live threads.
+// Param uint32_t "stackSize": stack size in words, 0 for the default STACKSIZE.
+// Return: sched_ErrCode_t
+sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, char *name, uint8_t threadID, uint32_t stackSize) {
+    return G8RTOS_AddThreadHandle(threadToAdd, priority, name, threadID, stackSize, NULL);
+}
+
+// G8RTOS_AddThreadHandle
+// G8RTOS_AddThread that also returns the new thread's handle, taken in the
+// same critical section, so it cannot refer to a thread created later.
 // Param void* "threadToAdd": pointer to thread function address
 // Param uint8_t "priority": priority from 0, 255.
 // Param char* "name": character array containing the thread name.
+// Param uint8_t "threadID": ID, unique among live threads.
+// Param uint32_t "stackSize": stack size in words, 0 for the default STACKSIZE.
+// Param threadHandle_t* "handle": set to the handle, INVALID_THREAD_HANDLE on error; may be NULL
 // Return: sched_ErrCode_t
-sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, char *name, uint8_t threadID) {
+sched_ErrCode_t G8RTOS_AddThreadHandle(void (*threadToAdd)(void), uint8_t priority, char *name, uint8_t threadID, uint32_t stackSize, threadHandle_t* handle) {
     // This should be in a critical section!
     int32_t i_bit = StartCriticalSection();
-    // If number of threads is greater than the maximum number of threads, return
-    if (NumberOfThreads >= MAX_THREADS) {
+    /* Round the stack up to an even number of words to keep it 8-byte aligned. */
+    if (!stackSize) stackSize = STACKSIZE;
+    if (stackSize < MIN_STACKSIZE) stackSize = MIN_STACKSIZE;
+    stackSize = (stackSize + 1) & ~1;
+    sched_ErrCode_t status = CreateThread(threadToAdd, priority, name, threadID, NULL, stackSize, NULL);
+    if (handle) *handle = (status == NO_ERROR) ? HandleOf(ThreadOfID(threadID)) : INVALID_THREAD_HANDLE;
+    EndCriticalSection(i_bit);
+    return status;
+}
+
+// G8RTOS_AddStaticThreads
+// Adds threads declared at compile time with G8RTOS_STATIC_THREAD, whose
+// stacks are declared with G8RTOS_STACK instead of carved from the arena.
+// The whole table is added in one critical section; if an entry fails, the
+// entries before it stay added.
+// Param "threads": table of thread declarations, may be const
+// Param "count": number of entries
+// Return: sched_ErrCode_t, STACK_TOO_SMALL for a stack under MIN_STACKSIZE words
+sched_ErrCode_t G8RTOS_AddStaticThreads(const G8RTOS_StaticThread_t* threads, uint32_t count) {
+    int32_t i_bit = StartCriticalSection();
+    sched_ErrCode_t status = NO_ERROR;
+    for (uint32_t i = NULL; i < count && status == NO_ERROR; i++) {
+        /* The initial frame is written below the top of the stack. */
+        if (!threads[i].stack || threads[i].stackSize < MIN_STACKSIZE) {
+            status = STACK_TOO_SMALL;
+            break;
+        }
+        status = CreateThread(threads[i].function, threads[i].priority, threads[i].name,
+                              threads[i].threadID, threads[i].stack, threads[i].stackSize & ~1, NULL);
+    }
+    EndCriticalSection(i_bit);
+    return status;
+}
+
+// G8RTOS_AddRealTimeThread
+// Adds a periodic real-time thread, scheduled under RT_POLICY. Its first job
+// is released now; each job ends with G8RTOS_WaitNextPeriod. The thread is
+// only added if admission control finds that every real-time thread,
+// including this one, still meets its deadlines.
+// Param "threadToAdd": thread function, looping over jobs
+// Param "name": thread name
+// Param "threadID": ID, unique among live threads
+// Param "stackSize": stack size in words, 0 for the default STACKSIZE
+// Param "period": ticks between releases
+// Param "budget": worst-case execution time of a job, in ticks
+// Param "deadline": ticks from release a job must finish by, 0 for the period
+// Return: sched_ErrCode_t, ADMISSION_REJECTED if the thread set would not be
+//         schedulable or the parameters are inconsistent
+sched_ErrCode_t G8RTOS_AddRealTimeThread(void (*threadToAdd)(void), char *name, uint8_t threadID, uint32_t stackSize,
+                                         uint32_t period, uint32_t budget, uint32_t deadline) {
+    if (!deadline) deadline = period;
+    if (!budget || budget > deadline || deadline > period) return ADMISSION_REJECTED;
+    if (!stackSize) stackSize = STACKSIZE;
+    if (stackSize < MIN_STACKSIZE) stackSize = MIN_STACKSIZE;
+    stackSize = (stackSize + 1) & ~1;
+    int32_t i_bit = StartCriticalSection();
+    rtcb_t* rt = NULL;
+    for (uint32_t i = NULL; i < MAX_RT_THREADS && !rt; i++) {
+        if (!rtControlBlocks[i].isActive) rt = &rtControlBlocks[i];
+    }
+    if (!rt) {
         EndCriticalSection(i_bit);
         return THREAD_LIMIT_REACHED;
     }
-    /* Used to find a spot in the tcb to place a new thread! */
-    uint32_t spotIndex = NULL;
-    // if no threads
-    if (!NumberOfThreads) {
-        threadControlBlocks[spotIndex].nextTCB = &threadControlBlocks[spotIndex];
-        threadControlBlocks[spotIndex].previousTCB = &threadControlBlocks[spotIndex];
-        threadHead = &threadControlBlocks[spotIndex];
-
-    } else {
-        for (uint32_t i = NULL; i < MAX_THREADS; i++) {
-            if (!threadControlBlocks[i].isAlive) {
-                spotIndex = i;
-                break;
-            }
-        }
-        threadControlBlocks[spotIndex].previousTCB = threadTail;
-        threadControlBlocks[spotIndex].nextTCB = threadHead;
-        threadTail->nextTCB = &threadControlBlocks[spotIndex];
-        threadHead->previousTCB = &threadControlBlocks[spotIndex];
+    rt->period = period;
+    rt->budget = budget;
+    rt->deadline = deadline;
+    if (!Admissible(rt)) {
+        EndCriticalSection(i_bit);
+        return ADMISSION_REJECTED;
     }
-    /* Set up thread stack. */
-    SetInitialStack(spotIndex);
-    /* Thread address saved onto the stack. */
-    threadStacks[spotIndex][STACKSIZE - 2] = (uint32_t)(threadToAdd);
-    /* Set up thread info. */
-    threadControlBlocks[spotIndex].priority = priority;
-    threadControlBlocks[spotIndex].ThreadID = threadID;
-    uint32_t index = NULL;
-    while (name[index] != '\0' && index < MAX_NAME_LENGTH) {
-        threadControlBlocks[spotIndex].threadName[index] = name[index];
-        index++;
+    rt->release = SystemTime;
+    rt->absoluteDeadline = SystemTime + deadline;
+    rt->jobStart = NULL;
+    rt->jobs = NULL;
+    rt->deadlineMisses = NULL;
+    rt->budgetOverruns = NULL;
+    rt->worstResponse = NULL;
+    sched_ErrCode_t status = CreateThread(threadToAdd, RT_PRIORITY_BASE, name, threadID, NULL, stackSize, rt);
+    if (status == NO_ERROR) {
+        rt->isActive = true;
+#if RT_POLICY == RT_POLICY_RM
+        RankRealTimeThreads();
+#endif
     }
-    /* By default, threads should be awake and alive. */
-    threadControlBlocks[spotIndex].asleep = false;
-    threadControlBlocks[spotIndex].isAlive = true;
-    /* Increment thread count, update the tail pointer, and return. */
-    NumberOfThreads++;
-    threadTail = &threadControlBlocks[spotIndex];
     EndCriticalSection(i_bit);
-    return NO_ERROR;
+    return status;
 }
 
 // G8RTOS_Add_APeriodicEvent
 // Param void* "AthreadToAdd": pointer to thread function address
-// Param int32_t "IRQn": Interrupt request number that references the vector table. [0..155].
+// Param uint8_t "priority": interrupt priority, OSINT_PRIORITY (0 without KERNEL_BASEPRI) to HWI_PRIORITY_LOWEST
+// Param int32_t "IRQn": Interrupt request number that references the vector table. [0..154].
 // Return: sched_ErrCode_t
 sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t priority, int32_t IRQn) {
     // Disable interrupts
     int32_t i_bit = StartCriticalSection();
     // Check if IRQn is valid
-    if (IRQn < NULL || IRQn > 155) {
+    if (IRQn < NULL || IRQn >= NUM_INTERRUPTS) {
         EndCriticalSection(i_bit);
         return IRQn_INVALID;
     }
     // Check if priority is valid
-    if (priority > 6) {
+    if (priority > HWI_PRIORITY_LOWEST) {
         EndCriticalSection(i_bit);
         return HWI_PRIORITY_INVALID;
     }
+#if KERNEL_BASEPRI
+    /* Interrupts above the BASEPRI ceiling are not masked by the kernel. */
+    if (priority < OSINT_PRIORITY) {
+        EndCriticalSection(i_bit);
+        return HWI_PRIORITY_INVALID;
+    }
+#endif
     // Set corresponding index in interrupt vector table to handler.
+#if G8RTOS_TRACE
+    TracedHandlers[IRQn] = AthreadToAdd;
+    IntRegister(IRQn, TracedISR);
+#else
     IntRegister(IRQn, AthreadToAdd);
+#endif
     // Set priority.
-    IntPrioritySet(IRQn, priority);
+    IntPrioritySet(IRQn, priority << HWI_PRIORITY_SHIFT);
     // Enable the interrupt.
     IntEnable(IRQn);
     // End the critical section.
@@ -266,111 +1262,199 @@ sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t pr
 // G8RTOS_Add_PeriodicEvent
 // Adds periodic threads to G8RTOS Scheduler
 // Function will initialize a periodic event struct to represent event.
-// The struct will be added to a linked list of periodic events
+// The struct will be inserted into the release queue, sorted by release time.
 // Param void* "PThreadToAdd": void-void function for P thread handler
 // Param uint32_t "period": period of P thread to add
-// Param uint32_t "execution": When to execute the periodic thread
-// Return: sched_ErrCode_t
+// Param uint32_t "execution": phase offset, in ticks, of the first release
+// Return: sched_ErrCode_t, INVALID_PERIOD for a zero period
 sched_ErrCode_t G8RTOS_Add_PeriodicEvent(void (*PThreadToAdd)(void), uint32_t period, uint32_t execution) {
+    if (!period) return INVALID_PERIOD;
+    int32_t i_bit = StartCriticalSection();
     // Make sure that the number of PThreads is not greater than max PThreads.
-    if (NumberOfPThreads >= MAX_PTHREADS) return THREAD_LIMIT_REACHED;
-        // Check if there is no PThread. Initialize and set the first PThread.
-    if (!NumberOfPThreads) {
-        pthreadControlBlocks[NULL].nextPTCB = &pthreadControlBlocks[NULL];
-        pthreadControlBlocks[NULL].previousPTCB = &pthreadControlBlocks[NULL];
-    } else {
-        // Subsequent PThreads should be added, inserted similarly to a doubly-linked linked list
-            // last PTCB should point to first, first PTCB should point to last.
-        pthreadControlBlocks[NumberOfPThreads].nextPTCB = &pthreadControlBlocks[NULL];
-        pthreadControlBlocks[NumberOfPThreads - 1].nextPTCB = &pthreadControlBlocks[NumberOfPThreads];
-        pthreadControlBlocks[NULL].previousPTCB = &pthreadControlBlocks[NumberOfPThreads];
-        pthreadControlBlocks[NumberOfPThreads].previousPTCB = &pthreadControlBlocks[NumberOfPThreads - 1];
+    if (NumberOfPThreads >= MAX_PTHREADS) {
+        EndCriticalSection(i_bit);
+        return THREAD_LIMIT_REACHED;
     }
+    // Find a free periodic control block
+    uint32_t spotIndex = NULL;
+    while (pthreadControlBlocks[spotIndex].isActive) spotIndex++;
+    ptcb_t* event = &pthreadControlBlocks[spotIndex];
         // Set function
-    pthreadControlBlocks[NumberOfPThreads].handler = PThreadToAdd;
+    event->handler = PThreadToAdd;
         // Set period
-    pthreadControlBlocks[NumberOfPThreads].period = period;
+    event->period = period;
         // Set execute time
-    pthreadControlBlocks[NumberOfPThreads].executeTime = execution;
-    /* Configure current time */
-    pthreadControlBlocks[NumberOfPThreads].currentTime = SystemTime + period;
+    event->executeTime = execution;
+    event->isActive = true;
+    event->isDue = false;
+    /* The first release happens "execution" ticks from now, then every period. */
+    AddToReleaseQueue(event, execution ? execution : 1);
         // Increment number of PThreads
     NumberOfPThreads++;
+    EndCriticalSection(i_bit);
     return NO_ERROR;
 }
 
-// G8RTOS_KillThread
-// Does not work for killing CurrentlyRunningThread
-//      see G8RTOS_KillSelf for this instead.
-// Param uint32_t "threadID": ID of thread to kill
+// G8RTOS_Remove_PeriodicEvent
+// Removes a periodic event from the release queue, along with a release
+// still waiting for the periodic thread.
+// Param void* "PThreadToRemove": handler the event was added with
 // Return: sched_ErrCode_t
-sched_ErrCode_t G8RTOS_KillThread(threadID_t threadID) {
-    // Start critical section
+sched_ErrCode_t G8RTOS_Remove_PeriodicEvent(void (*PThreadToRemove)(void)) {
     int32_t i_bit = StartCriticalSection();
-    // Check if there is only one thread, return if so
-    if (NumberOfThreads <= 1) {
-        EndCriticalSection(i_bit);
-        return CANNOT_KILL_LAST_THREAD;
-    }
-    // Traverse linked list, find thread to kill
-    tcb_t* iter = CurrentlyRunningThread->nextTCB;
-    for (uint32_t i = NULL; i < NumberOfThreads - 1; i++) {
-        // Update the next tcb and prev tcb pointers if found
-        if (iter->ThreadID == threadID) {
-            (iter->previousTCB)->nextTCB = iter->nextTCB;
-            (iter->nextTCB)->previousTCB = iter->previousTCB;
-            // mark as not alive, release the semaphore it is blocked on
-            iter->isAlive = false;
-            if (*(iter->blocked) < NULL) G8RTOS_SignalSemaphore(iter->blocked);
-            (iter->blocked) = NULL;
-            NumberOfThreads--;
-            /* If the thread is the tail, update tail pointer. */
-            if (iter == threadTail) threadTail = threadTail->previousTCB;
+    for (uint32_t i = NULL; i < MAX_PTHREADS; i++) {
+        ptcb_t* event = &pthreadControlBlocks[i];
+        if (event->isActive && event->handler == PThreadToRemove) {
+            RemoveFromReleaseQueue(event);
+#if PERIODIC_DEFERRED
+            if (event->isDue) {
+                /* Take it out of the due list, the periodic thread skips its count. */
+                ptcb_t** link = &DueHead;
+                ptcb_t* previous = NULL;
+                while (*link != event) {
+                    previous = *link;
+                    link = &(*link)->nextDuePTCB;
+                }
+                *link = event->nextDuePTCB;
+                if (DueTail == event) DueTail = previous;
+                event->isDue = false;
+            }
+#endif
+            event->isActive = false;
+            NumberOfPThreads--;
             EndCriticalSection(i_bit);
             return NO_ERROR;
         }
-        iter = iter->nextTCB;
     }
-    // Otherwise, thread does not exist.
     EndCriticalSection(i_bit);
     return THREAD_DOES_NOT_EXIST;
 }
 
+// G8RTOS_KillThread
+// Kills a thread by ID, which may be the running thread.
+// Param threadID_t "threadID": ID of thread to kill
+// Return: sched_ErrCode_t
+sched_ErrCode_t G8RTOS_KillThread(threadID_t threadID) {
+    int32_t i_bit = StartCriticalSection();
+    sched_ErrCode_t status = Kill(ThreadOfID(threadID));
+    EndCriticalSection(i_bit);
+    WaitForSwitch(status);
+    return status;
+}
+
+// G8RTOS_KillThreadHandle
+// Kills a thread by handle. A handle to a thread that has already been
+// killed is rejected even if its TCB has been reused.
+// Param "handle": handle from G8RTOS_AddThreadHandle or G8RTOS_GetThreadHandle
+// Return: sched_ErrCode_t
+sched_ErrCode_t G8RTOS_KillThreadHandle(threadHandle_t handle) {
+    int32_t i_bit = StartCriticalSection();
+    sched_ErrCode_t status = Kill(ThreadOfHandle(handle));
+    EndCriticalSection(i_bit);
+    WaitForSwitch(status);
+    return status;
+}
+
 // G8RTOS_KillSelf
 // Kills currently running thread.
 // Return: sched_ErrCode_t
 sched_ErrCode_t G8RTOS_KillSelf(void) {
     int32_t i_bit = StartCriticalSection();
-    // Check if there is only one thread
-    if (NumberOfThreads <= 1) {
+    sched_ErrCode_t status = Kill(CurrentlyRunningThread);
+    EndCriticalSection(i_bit);
+    WaitForSwitch(status);
+    return status;
+}
+
+// G8RTOS_ExitISR
+// Call at the end of an interrupt handler that used the FromISR calls. Pends
+// a single context switch, taken once every active handler has returned,
+// if any of them readied a thread that outranks the interrupted one.
+// Without this call the switch happens on the next systick.
+// Return: void
+void G8RTOS_ExitISR(void) {
+    if (SwitchPendingFromISR) {
+        SwitchPendingFromISR = false;
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    }
+    return;
+}
+
+// G8RTOS_SetTimeSlice
+// Sets how many ticks a thread runs before the next ready thread of the same
+// priority gets a turn. Threads join the back of their ready list and keep
+// the rest of their slice when preempted by a higher priority thread.
+// Param threadID_t "threadID": ID of the thread
+// Param uint16_t "ticks": slice length, 0 to run until it blocks or sleeps
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such thread
+sched_ErrCode_t G8RTOS_SetTimeSlice(threadID_t threadID, uint16_t ticks) {
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* thread = ThreadOfID(threadID);
+    if (!thread) {
         EndCriticalSection(i_bit);
-        return CANNOT_KILL_LAST_THREAD;
-    }
-    (CurrentlyRunningThread->previousTCB)->nextTCB = CurrentlyRunningThread->nextTCB;
-    (CurrentlyRunningThread->nextTCB)->previousTCB = CurrentlyRunningThread->previousTCB;
-    // Else, mark this thread as not alive.
-    CurrentlyRunningThread->isAlive = false;
-    if (*(CurrentlyRunningThread->blocked) < NULL) G8RTOS_SignalSemaphore(CurrentlyRunningThread->blocked);
-    CurrentlyRunningThread->blocked = NULL;
-    NumberOfThreads--;
-    /* If the current thread is the tail, update tail pointer. */
-    if (CurrentlyRunningThread == threadTail) threadTail = threadTail->previousTCB;
+        return THREAD_DOES_NOT_EXIST;
+    }
+    thread->timeSlice = ticks;
+    thread->sliceRemaining = ticks;
     EndCriticalSection(i_bit);
-    /* Perform context switch once thread is killed. */
-    HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
     return NO_ERROR;
 }
 
 // sleep
-// Puts current thread to sleep
+// Puts current thread to sleep by inserting it into the sleep delta list.
+// A duration of 0 sleeps until the next systick.
 // Param uint32_t "durationMS": how many systicks to sleep for
 void sleep(uint32_t durationMS) {
-    // Update time to sleep to
-    // Set thread as asleep
-    CurrentlyRunningThread->sleepCount = durationMS + SystemTime;
+    int32_t i_bit = StartCriticalSection();
+    // Set thread as asleep, move it from the ready list to the sleep list
     CurrentlyRunningThread->asleep = true;
+    RemoveFromReadyList(CurrentlyRunningThread);
+    AddToSleepList(CurrentlyRunningThread, durationMS ? durationMS : 1);
+    TRACE(TRACE_SLEEP, durationMS > 0xFFFF ? 0xFFFF : durationMS);
+    EndCriticalSection(i_bit);
     /* Perform context switch once thread is asleep. */
     HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    SWITCH_BARRIER();
+    return;
+}
+
+// G8RTOS_WaitNextPeriod
+// Ends the running real-time thread's job, recording a deadline miss if it
+// finished late, and sleeps until the next release. A job that overran into
+// its next period starts the next one at once. Does nothing in other threads.
+// Return: void
+void G8RTOS_WaitNextPeriod(void) {
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* thread = CurrentlyRunningThread;
+    rtcb_t* rt = thread->realTime;
+    if (!rt) {
+        EndCriticalSection(i_bit);
+        return;
+    }
+    uint32_t response = SystemTime - rt->release;
+    if (response > rt->worstResponse) rt->worstResponse = response;
+    /* SystemTime only reaches the deadline once the deadline has passed. */
+    if (response >= rt->deadline) rt->deadlineMisses++;
+    rt->jobs++;
+    /* The job's cycles are the thread's run cycles since it started, which
+     * leave out the time other threads preempted it for. */
+    uint64_t cycles = thread->runCycles + (uint32_t)(CYCLE_COUNT() - LastSchedulerCycles);
+    if (cycles - rt->jobStart > (uint64_t)rt->budget * CyclesPerTick) rt->budgetOverruns++;
+    rt->jobStart = cycles;
+    rt->release += rt->period;
+    rt->absoluteDeadline = rt->release + rt->deadline;
+    int32_t ticks = (int32_t)(rt->release - SystemTime);
+    RemoveFromReadyList(thread);
+    if (ticks > 0) {
+        thread->asleep = true;
+        AddToSleepList(thread, ticks);
+    } else {
+        /* Re-queue it under its new deadline. */
+        AddToReadyList(thread);
+    }
+    EndCriticalSection(i_bit);
+    HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    SWITCH_BARRIER();
     return;
 }
 
@@ -381,6 +1465,20 @@ threadID_t G8RTOS_GetThreadID(void) {
     return CurrentlyRunningThread->ThreadID;        //Returns the thread ID
 }
 
+// G8RTOS_GetThreadHandle
+// Gets a handle to a live thread. Unlike the ID, which a new thread may reuse
+// once the thread is killed, the handle then stops working.
+// Param threadID_t "threadID": ID of the thread
+// Return: threadHandle_t, INVALID_THREAD_HANDLE if there is no such thread
+threadHandle_t G8RTOS_GetThreadHandle(threadID_t threadID) {
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* thread = ThreadOfID(threadID);
+    threadHandle_t handle = INVALID_THREAD_HANDLE;
+    if (thread) handle = HandleOf(thread);
+    EndCriticalSection(i_bit);
+    return handle;
+}
+
 // G8RTOS_GetNumberOfThreads
 // Gets number of threads.
 // Return: uint32_t
@@ -391,3 +1489,76 @@ uint32_t G8RTOS_GetNumberOfThreads(void) {
 uint32_t G8RTOS_GetSysTime(void) {
     return SystemTime;
 }
+
+// G8RTOS_GetStackHighWater
+// Gets the peak stack usage of a thread, found by counting the words at the
+// bottom of its stack that still hold STACK_FILL_PATTERN.
+// Param threadID_t "threadID": ID of thread to check
+// Return: int32_t, peak usage in bytes, THREAD_DOES_NOT_EXIST if not found
+int32_t G8RTOS_GetStackHighWater(threadID_t threadID) {
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* thread = ThreadOfID(threadID);
+    if (!thread) {
+        EndCriticalSection(i_bit);
+        return THREAD_DOES_NOT_EXIST;
+    }
+    uint32_t untouched = NULL;
+    while (untouched < thread->stackSize && thread->stackBase[untouched] == STACK_FILL_PATTERN) untouched++;
+    EndCriticalSection(i_bit);
+    return (thread->stackSize - untouched) * sizeof(uint32_t);
+}
+
+// G8RTOS_GetThreadStats
+// Copies the run-time statistics of the thread in a TCB slot. Indexing by
+// slot rather than searching by ID keeps this constant time; walk indices
+// 0 to MAX_THREADS - 1 to see every thread.
+// Param uint32_t "index": TCB slot
+// Param G8RTOS_ThreadStats_t* "stats": filled in on success
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if the slot is empty
+sched_ErrCode_t G8RTOS_GetThreadStats(uint32_t index, G8RTOS_ThreadStats_t* stats) {
+    if (index >= MAX_THREADS) return THREAD_DOES_NOT_EXIST;
+    tcb_t* thread = &threadControlBlocks[index];
+    int32_t i_bit = StartCriticalSection();
+    if (!thread->isAlive) {
+        EndCriticalSection(i_bit);
+        return THREAD_DOES_NOT_EXIST;
+    }
+    stats->threadID = thread->ThreadID;
+    for (uint32_t i = NULL; i < MAX_NAME_LENGTH; i++) stats->threadName[i] = thread->threadName[i];
+    stats->priority = thread->priority;
+    stats->runCycles = thread->runCycles;
+    // Include the slice the running thread is in the middle of
+    if (thread == CurrentlyRunningThread) stats->runCycles += (uint32_t)(CYCLE_COUNT() - LastSchedulerCycles);
+    stats->switches = thread->switchCount;
+    stats->preemptions = thread->preemptCount;
+    EndCriticalSection(i_bit);
+    return NO_ERROR;
+}
+
+// G8RTOS_GetCPULoad
+// Gets the CPU load over the last complete window of LOAD_WINDOW_TICKS.
+// Return: uint32_t, load in tenths of a percent (0 to 1000)
+uint32_t G8RTOS_GetCPULoad(void) {
+    return CPULoad;
+}
+
+// G8RTOS_GetRealTimeStats
+// Copies the job statistics of a real-time thread.
+// Param threadID_t "threadID": ID of the thread
+// Param G8RTOS_RealTimeStats_t* "stats": filled in on success
+// Return: sched_ErrCode_t, THREAD_DOES_NOT_EXIST if there is no such real-time thread
+sched_ErrCode_t G8RTOS_GetRealTimeStats(threadID_t threadID, G8RTOS_RealTimeStats_t* stats) {
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* thread = ThreadOfID(threadID);
+    if (!thread || !thread->realTime) {
+        EndCriticalSection(i_bit);
+        return THREAD_DOES_NOT_EXIST;
+    }
+    rtcb_t* rt = thread->realTime;
+    stats->jobs = rt->jobs;
+    stats->deadlineMisses = rt->deadlineMisses;
+    stats->budgetOverruns = rt->budgetOverruns;
+    stats->worstResponse = rt->worstResponse;
+    EndCriticalSection(i_bit);
+    return NO_ERROR;
+}
@@ -1,6 +1,6 @@
 ; G8RTOS_SchedulerASM.s
 ; Created: 2022-07-26
-; Updated: 2024-04-08
+; Updated: 2026-10-16
 ; Contains assembly functions for scheduler.
 
 	; Functions Defined
@@ -9,6 +9,15 @@
 	; Dependencies
 	.ref CurrentlyRunningThread, G8RTOS_Scheduler
 
+	; Same definitions as G8RTOS_CriticalSection.s
+	.if !$isdefed("KERNEL_BASEPRI")
+KERNEL_BASEPRI	.set 0
+	.endif
+	.if !$isdefed("OSINT_PRIORITY")
+OSINT_PRIORITY	.set 1
+	.endif
+KERNEL_BASEPRI_CEILING	.set OSINT_PRIORITY << 5
+
 	.thumb		; Set to thumb mode
 	.align 2	; Align by 2 bytes (thumb mode uses allignment by 2 or 4)
 	.text		; Text section
@@ -30,13 +39,18 @@ G8RTOS_Start:
 	LDR R1, [R0]
 	; Load the first thread's stack pointer
 	LDR SP, [R1]
-	; Load registers with thread register values
+	; Load registers with thread register values, skipping the pad word
+	; and the EXC_RETURN of the frame SetInitialStack built
+	ADD SP, SP , #4
 	POP {R4-R11}
+	ADD SP, SP , #4
 	POP {R0-R3}
 	POP {R12}
 	; Load LR with the first thread's PC
 	ADD SP, SP , #4
 	POP {LR}
+	; Drop the PSR word, leaving SP 8-byte aligned at the top of the stack
+	ADD SP, SP , #4
 	; Enable interrupts at processor level
 	CPSIE I
 	; Branches to the first thread
@@ -51,23 +65,44 @@ G8RTOS_Start:
 ;	- Calls G8RTOS_Scheduler to get new tcb
 ;	- Set stack pointer to new stack pointer from new tcb
 ;	- Pops registers from thread stack
+; Threads that have used the FPU enter with EXC_RETURN bit 4 clear and an
+; extended frame reserved for S0-S15. Only those threads save S16-S31, which
+; also makes the core lazily fill in S0-S15; integer-only threads skip both.
+; With KERNEL_BASEPRI the switch masks with BASEPRI like the kernel critical
+; sections, leaving interrupts above OSINT_PRIORITY enabled.
 PendSV_Handler:
 
 	.asmfunc
 	; put your assembly code here!
+	.if KERNEL_BASEPRI
+	MOV R0, #KERNEL_BASEPRI_CEILING ; Prevent kernel interrupts during switch
+	MSR BASEPRI, R0
+	ISB
+	.else
 	CPSID I ; Prevent interrupt during switch
-	PUSH {R4-R11} ; save old threads registers
+	.endif
+	TST LR, #0x10 ; save old threads FPU registers if it used the FPU
+	IT EQ
+	VPUSHEQ {S16-S31}
+	PUSH {R3-R11, LR} ; save old threads registers and EXC_RETURN, R3 pads to 8 bytes
 	LDR R0, RunningPtr ; save current stack pointer
 	LDR R1, [R0]
 	STR SP, [R1]
-	PUSH {R0, LR}
 	BL G8RTOS_Scheduler ; call function to get new tcb
-	POP {R0, LR}
+	LDR R0, RunningPtr
 	LDR R1, [R0] ; set stack pointer to new stack pointer from new tcb
 	LDR SP, [R1]
-	POP {R4-R11} ; pop new threads registers
+	POP {R3-R11, LR} ; pop new threads registers and EXC_RETURN
+	TST LR, #0x10 ; restore new threads FPU registers if it used the FPU
+	IT EQ
+	VPOPEQ {S16-S31}
+	.if KERNEL_BASEPRI
+	MOV R0, #0 ; tasks run with interrupts enabled
+	MSR BASEPRI, R0
+	.else
 	CPSIE I ; tasks run with interrupts enabled
-	BX LR ; restore R0-R3, R12, LR, PC, PSR
+	.endif
+	BX LR ; restore R0-R3, R12, LR, PC, PSR (and S0-S15, FPSCR)
 
 	.endasmfunc
 
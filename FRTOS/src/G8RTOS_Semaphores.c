@@ -1,6 +1,6 @@
 // G8RTOS_Semaphores.c
 // Date Created: 2023-07-25
-// Date Updated: 2024-04-28
+// Date Updated: 2026-10-16
 // Defines for semaphore functions
 
 #include "../G8RTOS_Semaphores.h"
@@ -9,6 +9,7 @@
 
 #include "../G8RTOS_CriticalSection.h"
 #include "../G8RTOS_Scheduler.h"
+#include "../G8RTOS_Trace.h"
 
 #include "inc/hw_types.h"
 #include "inc/hw_nvic.h"
@@ -21,6 +22,24 @@
 
 /********************************Public Variables***********************************/
 
+/*******************************Private Functions***********************************/
+
+// Release
+// Increments the semaphore and makes its highest priority waiter ready, if any.
+// Call inside a critical section.
+// Param semaphore_t* "s": Pointer to semaphore
+// Return: tcb_t*, the thread made ready or NULL
+static tcb_t* Release(semaphore_t* s) {
+    (s->count)++;
+    if ((s->count) > NULL) return NULL;
+    tcb_t* ptr = s->waitQueue;
+    RemoveFromWaitQueue(ptr);
+    ptr->blocked = NULL;
+    AddToReadyList(ptr);
+    TRACE(TRACE_SEMAPHORE_UNBLOCK, ptr->ThreadID);
+    return ptr;
+}
+
 /********************************Public Functions***********************************/
 // G8RTOS_InitSemaphore
 // Initializes semaphore to a value.
@@ -29,7 +48,8 @@
 // Return: void
 void G8RTOS_InitSemaphore(semaphore_t* s, int32_t value) {
     int32_t i_bit = StartCriticalSection();
-    *s = value;
+    s->count = value;
+    s->waitQueue = NULL;
     EndCriticalSection(i_bit);
     return;
 }
@@ -40,32 +60,83 @@ void G8RTOS_InitSemaphore(semaphore_t* s, int32_t value) {
 // Param "s": Pointer to semaphore
 // Return: void
 void G8RTOS_WaitSemaphore(semaphore_t* s) {
+    /* Uncontended: take a unit without masking interrupts. */
+    if (AtomicTryDecrement(&s->count)) return;
     int32_t i_bit = StartCriticalSection();
-    (*s)--;
-    if ((*s) < NULL) {
+    (s->count)--;
+    if ((s->count) < NULL) {
         CurrentlyRunningThread->blocked = s;
+        RemoveFromReadyList(CurrentlyRunningThread);
+        AddToWaitQueue(&s->waitQueue, CurrentlyRunningThread);
+        TRACE(TRACE_SEMAPHORE_BLOCK, (uintptr_t)s >> 2);
         EndCriticalSection(i_bit);
         /* Run the thread switcher, i.e., no spin-locking! */
         HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+        SWITCH_BARRIER();
     } else {
         EndCriticalSection(i_bit);
     }
     return;
 }
 
+// G8RTOS_WaitSemaphoreTimeout
+// G8RTOS_WaitSemaphore that gives up after "timeout" systicks.
+// Param "s": Pointer to semaphore
+// Param "timeout": systicks to wait at most, 0 to only poll, or WAIT_FOREVER
+// Return: int32_t, NO_ERROR, or WAIT_TIMEOUT if the wait timed out
+int32_t G8RTOS_WaitSemaphoreTimeout(semaphore_t* s, uint32_t timeout) {
+    if (AtomicTryDecrement(&s->count)) return NO_ERROR;
+    int32_t i_bit = StartCriticalSection();
+    if ((s->count) > NULL || !timeout) {
+        bool taken = (s->count) > NULL;
+        if (taken) (s->count)--;
+        EndCriticalSection(i_bit);
+        return taken ? NO_ERROR : WAIT_TIMEOUT;
+    }
+    (s->count)--;
+    CurrentlyRunningThread->blocked = s;
+    RemoveFromReadyList(CurrentlyRunningThread);
+    AddToWaitQueue(&s->waitQueue, CurrentlyRunningThread);
+    StartTimeout(CurrentlyRunningThread, timeout);
+    TRACE(TRACE_SEMAPHORE_BLOCK, (uintptr_t)s >> 2);
+    EndCriticalSection(i_bit);
+    HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    SWITCH_BARRIER();
+    return CurrentlyRunningThread->timedOut ? WAIT_TIMEOUT : NO_ERROR;
+}
+
+// G8RTOS_TryWaitSemaphore
+// Decrements the semaphore only if that does not block. Safe to call from ISRs.
+// Param "s": Pointer to semaphore
+// Return: bool, true if the semaphore was taken
+bool G8RTOS_TryWaitSemaphore(semaphore_t* s) {
+    return AtomicTryDecrement(&s->count);
+}
+
 // G8RTOS_SignalSemaphore
 // Signals that the semaphore has been released by incrementing the value by 1.
-// Unblocks all threads currently blocked on the semaphore.
+// Wakes the highest priority thread blocked on the semaphore, if any.
 // Param "s": Pointer to semaphore
 // Return: void
 void G8RTOS_SignalSemaphore(semaphore_t* s) {
+    /* No waiters: release the unit without masking interrupts. */
+    if (AtomicTryIncrement(&s->count)) return;
     int32_t i_bit = StartCriticalSection();
-    (*s)++;
-    if ((*s) <= NULL) {
-        tcb_t* ptr = (tcb_t*)CurrentlyRunningThread->nextTCB;
-        while (ptr->blocked != s) ptr = ptr->nextTCB;
-        ptr->blocked = NULL;
-    }
+    Release(s);
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_SignalSemaphoreFromISR
+// G8RTOS_SignalSemaphore for interrupt handlers: if the woken thread outranks
+// the interrupted one, the switch is left to G8RTOS_ExitISR.
+// Param "s": Pointer to semaphore
+// Return: void
+void G8RTOS_SignalSemaphoreFromISR(semaphore_t* s) {
+    if (AtomicTryIncrement(&s->count)) return;
+    int32_t i_bit = StartCriticalSection();
+    tcb_t* woken = Release(s);
+    if (woken && woken->priority < CurrentlyRunningThread->priority) RequestSwitchFromISR();
     EndCriticalSection(i_bit);
     return;
 }
@@ -0,0 +1,359 @@
+// G8RTOS_Timer.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for software timer functions
+
+#include "../G8RTOS_Timer.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Scheduler.h"
+#include "../G8RTOS_Notify.h"
+
+/********************************Private Variables**********************************/
+
+// Timer List - delta list of running timers sorted by expiry
+static G8RTOS_Timer_t* TimerList;
+
+// Due List - expired timers waiting for the daemon, oldest first
+static G8RTOS_Timer_t* DueHead;
+static G8RTOS_Timer_t* DueTail;
+
+// Pending List - timers started from ISRs waiting for the daemon to insert
+// them into the timer list, linked through nextTimer/previousTimer
+static G8RTOS_Timer_t* PendingHead;
+static G8RTOS_Timer_t* PendingTail;
+
+/*******************************Private Functions***********************************/
+
+// AddToTimerList
+// Inserts a timer into the delta list to expire "ticks" ticks from now.
+// Walks the list, so it takes time linear in the number of running timers;
+// only threads call it. Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": timer to arm
+// Param uint32_t "ticks": ticks until it expires, at least 1
+// Return: void
+static void AddToTimerList(G8RTOS_Timer_t* timer, uint32_t ticks) {
+    G8RTOS_Timer_t* previous = NULL;
+    G8RTOS_Timer_t* iter = TimerList;
+    while (iter && iter->delta <= ticks) {
+        ticks -= iter->delta;
+        previous = iter;
+        iter = iter->nextTimer;
+    }
+    timer->delta = ticks;
+    timer->previousTimer = previous;
+    timer->nextTimer = iter;
+    if (previous) previous->nextTimer = timer;
+    else TimerList = timer;
+    if (iter) {
+        iter->delta -= ticks;
+        iter->previousTimer = timer;
+    }
+    timer->isRunning = true;
+    return;
+}
+
+// RemoveFromTimerList
+// Unlinks a running timer, giving its remaining ticks to the timer after it.
+// Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": running timer
+// Return: void
+static void RemoveFromTimerList(G8RTOS_Timer_t* timer) {
+    if (timer->nextTimer) {
+        (timer->nextTimer)->delta += timer->delta;
+        (timer->nextTimer)->previousTimer = timer->previousTimer;
+    }
+    if (timer->previousTimer) (timer->previousTimer)->nextTimer = timer->nextTimer;
+    else TimerList = timer->nextTimer;
+    timer->nextTimer = NULL;
+    timer->previousTimer = NULL;
+    timer->isRunning = false;
+    return;
+}
+
+// AddToDueList
+// Appends an expired timer to the due list.
+// Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": timer that just expired
+// Return: void
+static void AddToDueList(G8RTOS_Timer_t* timer) {
+    timer->previousDueTimer = DueTail;
+    timer->nextDueTimer = NULL;
+    if (DueTail) DueTail->nextDueTimer = timer;
+    else DueHead = timer;
+    DueTail = timer;
+    timer->isDue = true;
+    return;
+}
+
+// RemoveFromDueList
+// Takes an expired timer out of the due list.
+// Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": due timer
+// Return: void
+static void RemoveFromDueList(G8RTOS_Timer_t* timer) {
+    if (timer->nextDueTimer) (timer->nextDueTimer)->previousDueTimer = timer->previousDueTimer;
+    else DueTail = timer->previousDueTimer;
+    if (timer->previousDueTimer) (timer->previousDueTimer)->nextDueTimer = timer->nextDueTimer;
+    else DueHead = timer->nextDueTimer;
+    timer->nextDueTimer = NULL;
+    timer->previousDueTimer = NULL;
+    timer->isDue = false;
+    return;
+}
+
+// AddToPendingList
+// Queues a timer started from an ISR for the daemon to insert.
+// Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": stopped timer, with its expiry set
+// Return: void
+static void AddToPendingList(G8RTOS_Timer_t* timer) {
+    timer->previousTimer = PendingTail;
+    timer->nextTimer = NULL;
+    if (PendingTail) PendingTail->nextTimer = timer;
+    else PendingHead = timer;
+    PendingTail = timer;
+    timer->isPending = true;
+    return;
+}
+
+// RemoveFromPendingList
+// Takes a timer out of the pending list.
+// Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": pending timer
+// Return: void
+static void RemoveFromPendingList(G8RTOS_Timer_t* timer) {
+    if (timer->nextTimer) (timer->nextTimer)->previousTimer = timer->previousTimer;
+    else PendingTail = timer->previousTimer;
+    if (timer->previousTimer) (timer->previousTimer)->nextTimer = timer->nextTimer;
+    else PendingHead = timer->nextTimer;
+    timer->nextTimer = NULL;
+    timer->previousTimer = NULL;
+    timer->isPending = false;
+    return;
+}
+
+// Disarm
+// Takes a timer out of whichever lists it is in. Constant time.
+// Call inside a critical section.
+// Param G8RTOS_Timer_t* "timer": timer to stop
+// Return: void
+static void Disarm(G8RTOS_Timer_t* timer) {
+    if (timer->isRunning) RemoveFromTimerList(timer);
+    if (timer->isPending) RemoveFromPendingList(timer);
+    if (timer->isDue) RemoveFromDueList(timer);
+    return;
+}
+
+// TicksUntilExpiry
+// Gets the ticks from now until a timer's expiry. An expiry the daemon was
+// too late for moves to the next tick rather than bursting.
+// Param G8RTOS_Timer_t* "timer": timer with its expiry set
+// Return: uint32_t, at least 1
+static uint32_t TicksUntilExpiry(G8RTOS_Timer_t* timer) {
+    int32_t ticks = (int32_t)(timer->expiry - SystemTime);
+    if (ticks < 1) {
+        ticks = 1;
+        timer->expiry = SystemTime + 1;
+    }
+    return ticks;
+}
+
+// TimerDaemon
+// Inserts the timers started from ISRs, then runs the callbacks of expired
+// timers in expiry order, re-arming auto-reload timers from their previous
+// expiry so that they do not drift.
+static void TimerDaemon(void) {
+    while (1) {
+        G8RTOS_NotifyTake(true);
+        while (1) {
+            int32_t i_bit = StartCriticalSection();
+            G8RTOS_Timer_t* timer = PendingHead;
+            if (!timer) {
+                EndCriticalSection(i_bit);
+                break;
+            }
+            RemoveFromPendingList(timer);
+            AddToTimerList(timer, TicksUntilExpiry(timer));
+            EndCriticalSection(i_bit);
+        }
+        while (1) {
+            int32_t i_bit = StartCriticalSection();
+            G8RTOS_Timer_t* timer = DueHead;
+            if (!timer) {
+                EndCriticalSection(i_bit);
+                break;
+            }
+            RemoveFromDueList(timer);
+            /* A timer started again while it was due is already armed from that start. */
+            if (timer->autoReload && !timer->isRunning && !timer->isPending) {
+                timer->expiry += timer->period;
+                AddToTimerList(timer, TicksUntilExpiry(timer));
+            }
+            void (*callback)(G8RTOS_Timer_t*) = timer->callback;
+            EndCriticalSection(i_bit);
+            callback(timer);
+        }
+    }
+}
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_InitTimer
+// Sets up a stopped timer. Timers are owned by the caller, so any number can
+// be created without a kernel table.
+// Param "timer": Pointer to timer
+// Param "callback": run by the timer daemon each time the timer expires
+// Param "period": ticks from start to expiry, and between auto-reload expiries
+// Param "autoReload": restart automatically after each expiry
+// Param "context": stored in the timer for the callback
+// Return: void
+void G8RTOS_InitTimer(G8RTOS_Timer_t* timer, void (*callback)(G8RTOS_Timer_t*), uint32_t period, bool autoReload, void* context) {
+    timer->callback = callback;
+    timer->context = context;
+    timer->period = period ? period : 1;
+    timer->autoReload = autoReload;
+    timer->nextTimer = NULL;
+    timer->previousTimer = NULL;
+    timer->nextDueTimer = NULL;
+    timer->previousDueTimer = NULL;
+    timer->isRunning = false;
+    timer->isPending = false;
+    timer->isDue = false;
+    return;
+}
+
+// G8RTOS_StartTimer
+// Starts a stopped timer to expire one period from now. Does nothing if the
+// timer is already running. Threads only: the insert takes time linear in
+// the number of running timers, with interrupts masked.
+// Param "timer": Pointer to timer
+// Return: void
+void G8RTOS_StartTimer(G8RTOS_Timer_t* timer) {
+    int32_t i_bit = StartCriticalSection();
+    if (!timer->isRunning && !timer->isPending) {
+        timer->expiry = SystemTime + timer->period;
+        AddToTimerList(timer, timer->period);
+    }
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_StartTimerFromISR
+// G8RTOS_StartTimer for interrupt handlers, see G8RTOS_ExitISR. Takes
+// constant time: the expiry is fixed now, and the timer daemon inserts it.
+// Param "timer": Pointer to timer
+// Return: void
+void G8RTOS_StartTimerFromISR(G8RTOS_Timer_t* timer) {
+    int32_t i_bit = StartCriticalSection();
+    bool queued = !timer->isRunning && !timer->isPending;
+    if (queued) {
+        timer->expiry = SystemTime + timer->period;
+        AddToPendingList(timer);
+    }
+    EndCriticalSection(i_bit);
+    if (queued) G8RTOS_NotifyGiveFromISR(TIMER_THREAD_ID);
+    return;
+}
+
+// G8RTOS_StopTimer
+// Stops a timer, cancelling an expiry whose callback has not run yet.
+// Takes constant time. Safe to call from ISRs.
+// Param "timer": Pointer to timer
+// Return: void
+void G8RTOS_StopTimer(G8RTOS_Timer_t* timer) {
+    int32_t i_bit = StartCriticalSection();
+    Disarm(timer);
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_ResetTimer
+// Restarts a timer to expire one period from now, whether or not it is
+// running, e.g. to kick a watchdog or push back a timeout. Threads only,
+// see G8RTOS_StartTimer.
+// Param "timer": Pointer to timer
+// Return: void
+void G8RTOS_ResetTimer(G8RTOS_Timer_t* timer) {
+    int32_t i_bit = StartCriticalSection();
+    Disarm(timer);
+    timer->expiry = SystemTime + timer->period;
+    AddToTimerList(timer, timer->period);
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_ResetTimerFromISR
+// G8RTOS_ResetTimer for interrupt handlers, see G8RTOS_StartTimerFromISR.
+// Param "timer": Pointer to timer
+// Return: void
+void G8RTOS_ResetTimerFromISR(G8RTOS_Timer_t* timer) {
+    int32_t i_bit = StartCriticalSection();
+    Disarm(timer);
+    timer->expiry = SystemTime + timer->period;
+    AddToPendingList(timer);
+    EndCriticalSection(i_bit);
+    G8RTOS_NotifyGiveFromISR(TIMER_THREAD_ID);
+    return;
+}
+
+// G8RTOS_TimerIsActive
+// Checks whether a timer is running, waiting to be inserted, or has expired
+// with its callback pending.
+// Param "timer": Pointer to timer
+// Return: bool
+bool G8RTOS_TimerIsActive(G8RTOS_Timer_t* timer) {
+    return timer->isRunning || timer->isPending || timer->isDue;
+}
+
+// InitTimerService
+// Empties the timer lists and adds the timer daemon thread.
+// Called by G8RTOS_Init when SOFTWARE_TIMERS is set.
+// Return: void
+void InitTimerService(void) {
+    TimerList = NULL;
+    DueHead = NULL;
+    DueTail = NULL;
+    PendingHead = NULL;
+    PendingTail = NULL;
+    G8RTOS_AddThread(TimerDaemon, TIMER_DAEMON_PRIORITY, "timers", TIMER_THREAD_ID, TIMER_STACKSIZE);
+    return;
+}
+
+// TimerTick
+// Counts down the first running timer and moves every timer that is now due
+// to the due list, waking the daemon. Called by SysTick_Handler, after
+// SystemTime is incremented. Constant time unless timers expire.
+// Return: void
+void TimerTick(void) {
+    if (!TimerList) return;
+    TimerList->delta--;
+    if (TimerList->delta) return;
+    while (TimerList && !TimerList->delta) {
+        G8RTOS_Timer_t* timer = TimerList;
+        RemoveFromTimerList(timer);
+        AddToDueList(timer);
+    }
+    /* SysTick_Handler pends the switch if the daemon outranks the running thread. */
+    G8RTOS_NotifyGiveFromISR(TIMER_THREAD_ID);
+    return;
+}
+
+// NextTimerExpiry
+// Gets the number of ticks until the first running timer expires.
+// Return: uint32_t, UINT32_MAX if no timer is running
+uint32_t NextTimerExpiry(void) {
+    return TimerList ? TimerList->delta : UINT32_MAX;
+}
+
+// StepTimers
+// Accounts for ticks skipped by tickless idle, which never skips past the
+// first expiry.
+// Param uint32_t "ticks": number of ticks skipped
+// Return: void
+void StepTimers(uint32_t ticks) {
+    if (TimerList) TimerList->delta -= ticks;
+    return;
+}
@@ -0,0 +1,70 @@
+// G8RTOS_Trace.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Defines for kernel event trace functions
+
+#include "../G8RTOS_Trace.h"
+
+/************************************Includes***************************************/
+
+#include "../G8RTOS_Scheduler.h"
+#include "../G8RTOS_CriticalSection.h"
+#include "../G8RTOS_Cycles.h"
+
+#include "driverlib/sysctl.h"
+
+/********************************Public Variables***********************************/
+
+G8RTOS_Trace_t G8RTOS_TraceBuffer;
+
+/********************************Public Functions***********************************/
+
+// G8RTOS_TraceInit
+// Clears the trace buffer and starts recording.
+// Called by G8RTOS_Init when G8RTOS_TRACE is set.
+// Return: void
+void G8RTOS_TraceInit(void) {
+    G8RTOS_TraceBuffer.magic = TRACE_MAGIC;
+    G8RTOS_TraceBuffer.clockHz = SysCtlClockGet();
+    G8RTOS_TraceBuffer.size = TRACE_BUFFER_SIZE;
+    G8RTOS_TraceBuffer.head = NULL;
+    G8RTOS_TraceBuffer.enabled = true;
+    return;
+}
+
+// G8RTOS_TraceRecord
+// Appends a record to the trace buffer, overwriting the oldest one when full.
+// Safe to call from threads and interrupt handlers.
+// Param uint8_t "event": trace_Event_t
+// Param uint16_t "arg": event argument
+// Return: void
+void G8RTOS_TraceRecord(uint8_t event, uint16_t arg) {
+    int32_t i_bit = StartCriticalSection();
+    if (G8RTOS_TraceBuffer.enabled) {
+        traceRecord_t* record = &G8RTOS_TraceBuffer.records[G8RTOS_TraceBuffer.head & (TRACE_BUFFER_SIZE - 1)];
+        G8RTOS_TraceBuffer.head++;
+        record->timestamp = CYCLE_COUNT();
+        record->event = event;
+        record->thread = CurrentlyRunningThread ? (uint8_t)CurrentlyRunningThread->ThreadID : 0xFF;
+        record->arg = arg;
+    }
+    EndCriticalSection(i_bit);
+    return;
+}
+
+// G8RTOS_TraceStart
+// Resumes recording.
+// Return: void
+void G8RTOS_TraceStart(void) {
+    G8RTOS_TraceBuffer.enabled = true;
+    return;
+}
+
+// G8RTOS_TraceStop
+// Stops recording, e.g. right after a latency spike, so the records leading
+// up to it are kept until the buffer is dumped.
+// Return: void
+void G8RTOS_TraceStop(void) {
+    G8RTOS_TraceBuffer.enabled = false;
+    return;
+}
@@ -0,0 +1,170 @@
+// G8RTOS_TraceDecode.c
+// Date Created: 2026-10-16
+// Date Updated: 2026-10-16
+// Host tool: decodes a memory dump of G8RTOS_TraceBuffer (see G8RTOS_Trace.h)
+// into Chrome trace JSON, viewable in chrome://tracing or Perfetto.
+//
+// Dump the buffer with the debugger, e.g. in gdb:
+//   dump binary memory trace.bin &G8RTOS_TraceBuffer (&G8RTOS_TraceBuffer + 1)
+// then run:
+//   g8rtos_trace_decode trace.bin > trace.json
+//
+// Threads appear as rows showing when they ran; other events are instants on
+// the row of the thread that was running. Interrupts get a row per vector.
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Must match G8RTOS_Trace.h
+#define TRACE_MAGIC             0x52543847
+#define TRACE_HEADER_BYTES      20
+#define TRACE_RECORD_BYTES      8
+#define TRACE_SWITCH            1
+#define TRACE_ISR_ENTER         10
+#define TRACE_ISR_EXIT          11
+
+#define NO_THREAD               0xFF
+#define ISR_ROW                 1000    // Row of vector n is ISR_ROW + n
+
+/*************************************Defines***************************************/
+
+/********************************Private Variables**********************************/
+
+static const char* EventNames[] = {
+    "?", "switch", "semaphore block", "semaphore unblock", "FIFO read", "FIFO write",
+    "FIFO lost", "sleep", "wake", "periodic release", "ISR enter", "ISR exit",
+};
+
+static const char* ArgNames[] = {
+    "arg", "to", "semaphore", "thread", "FIFO", "FIFO",
+    "FIFO", "ms", "thread", "event", "vector", "vector",
+};
+
+static double ClockMHz;
+static const char* Separator = "";
+
+/********************************Private Variables**********************************/
+
+/*******************************Private Functions***********************************/
+
+static uint32_t Read32(const uint8_t* bytes) {
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static double Microseconds(uint64_t cycles) {
+    return cycles / ClockMHz;
+}
+
+static void EmitRow(uint32_t row, const char* kind, uint32_t id) {
+    printf("%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}",
+           Separator, row, kind, id);
+    Separator = ",";
+    return;
+}
+
+static void EmitSlice(uint32_t thread, uint64_t start, uint64_t end) {
+    printf("%s\n{\"ph\":\"X\",\"name\":\"running\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+           Separator, thread, Microseconds(start), Microseconds(end - start));
+    Separator = ",";
+    return;
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <G8RTOS_TraceBuffer dump>\n", argv[0]);
+        return 2;
+    }
+    FILE* file = fopen(argv[1], "rb");
+    if (!file) {
+        perror(argv[1]);
+        return 1;
+    }
+    uint8_t header[TRACE_HEADER_BYTES];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) || Read32(header) != TRACE_MAGIC) {
+        fprintf(stderr, "%s: not a G8RTOS trace dump\n", argv[1]);
+        return 1;
+    }
+    uint32_t clockHz = Read32(header + 4);
+    uint32_t size = Read32(header + 8);
+    uint32_t head = Read32(header + 12);
+    ClockMHz = (clockHz ? clockHz : 1000000) / 1e6;
+
+    uint8_t* records = malloc((size_t)size * TRACE_RECORD_BYTES);
+    if (!records || fread(records, TRACE_RECORD_BYTES, size, file) != size) {
+        fprintf(stderr, "%s: truncated dump\n", argv[1]);
+        return 1;
+    }
+    fclose(file);
+
+    // Oldest record first
+    uint32_t count = head < size ? head : size;
+    uint32_t first = head < size ? 0 : head % size;
+
+    uint8_t seenThread[256] = { 0 };
+    uint8_t seenVector[256] = { 0 };
+    uint64_t now = 0;
+    uint32_t lastStamp = 0;
+    uint32_t running = NO_THREAD;
+    uint64_t runStart = 0;
+    int started = 0;
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* record = records + (size_t)((first + i) % size) * TRACE_RECORD_BYTES;
+        uint32_t stamp = Read32(record);
+        uint32_t event = record[4];
+        uint32_t thread = record[5];
+        uint32_t arg = record[6] | (record[7] << 8);
+
+        // Timestamps are 32-bit and wrap; records are in order, so unwrap them.
+        if (i) now += (uint32_t)(stamp - lastStamp);
+        lastStamp = stamp;
+
+        if (!seenThread[thread]) {
+            EmitRow(thread, "thread", thread);
+            seenThread[thread] = 1;
+        }
+        if (!started) {
+            running = thread;
+            runStart = now;
+            started = 1;
+        }
+
+        if (event == TRACE_SWITCH) {
+            EmitSlice(running, runStart, now);
+            running = arg & 0xFF;
+            if (!seenThread[running]) {
+                EmitRow(running, "thread", running);
+                seenThread[running] = 1;
+            }
+            runStart = now;
+        } else if (event == TRACE_ISR_ENTER || event == TRACE_ISR_EXIT) {
+            uint32_t vector = arg & 0xFF;
+            if (!seenVector[vector]) {
+                EmitRow(ISR_ROW + vector, "vector", vector);
+                seenVector[vector] = 1;
+            }
+            printf("%s\n{\"ph\":\"%s\",\"name\":\"ISR %u\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}",
+                   Separator, event == TRACE_ISR_ENTER ? "B" : "E", vector, ISR_ROW + vector, Microseconds(now));
+        } else {
+            uint32_t known = event < sizeof(EventNames) / sizeof(EventNames[0]);
+            printf("%s\n{\"ph\":\"i\",\"s\":\"t\",\"name\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"%s\":%u}}",
+                   Separator, EventNames[known ? event : 0], thread, Microseconds(now),
+                   ArgNames[known ? event : 0], arg);
+        }
+        Separator = ",";
+    }
+    if (started) EmitSlice(running, runStart, now);
+    printf("\n]}\n");
+    free(records);
+    return 0;
+}